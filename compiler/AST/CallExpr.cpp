@@ -19,6 +19,7 @@
 
 #include "CallExpr.h"
 
+#include "astPool.h"
 #include "astutil.h"
 #include "AstVisitor.h"
 #include "passes.h"
@@ -28,6 +29,8 @@
 
 static void callExprHelper(CallExpr* call, BaseAST* arg);
 
+DEFINE_AST_POOL(CallExpr)
+
 CallExpr::CallExpr(BaseAST* base,
                    BaseAST* arg1,
                    BaseAST* arg2,
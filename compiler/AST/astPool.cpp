@@ -0,0 +1,229 @@
+/*
+ * Copyright 2004-2019 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "astPool.h"
+
+#include <cstdlib>
+#include <new>
+#include <stdint.h>
+
+// Slabs are aligned to their size so that the slab owning a slot can be
+// found by masking the slot's address.
+static const size_t kSlabBytes   = 64 * 1024;
+static const size_t kSlotAlign   = 16;
+
+struct AstPool::FreeSlot {
+  FreeSlot* next;
+};
+
+struct AstPool::Slab {
+  Slab*     prev;              // links on the pool's partial list
+  Slab*     next;
+  FreeSlot* freeList;          // slots released back into this slab
+  size_t    numBumped;         // slots ever handed out from this slab
+  size_t    numLive;
+  bool      isPartial;
+};
+
+static size_t roundUp(size_t n, size_t align) {
+  return (n + align - 1) & ~(align - 1);
+}
+
+static const size_t kSlabHeader = (sizeof(AstPool::Slab) + kSlotAlign - 1) &
+                                  ~(kSlotAlign - 1);
+
+static AstPool* sPools = NULL;
+
+AstPool::AstPool(const char* name, size_t slotSize) :
+  name(name),
+  slotSize(roundUp(slotSize, kSlotAlign)),
+  slotsPerSlab(0),
+  partial(NULL),
+  nextPool(sPools),
+  numSlabs(0),
+  maxSlabs(0),
+  numLive(0),
+  numOversize(0)
+{
+  slotsPerSlab = (kSlabBytes - kSlabHeader) / this->slotSize;
+
+  sPools       = this;
+}
+
+void* AstPool::allocate(size_t size) {
+  if (roundUp(size, kSlotAlign) != slotSize) {
+    numOversize++;
+
+    return ::operator new(size);
+  }
+
+  if (partial == NULL) {
+    linkPartial(newSlab());
+  }
+
+  Slab* slab = partial;
+  void* retval = NULL;
+
+  if (slab->freeList != NULL) {
+    retval         = slab->freeList;
+    slab->freeList = slab->freeList->next;
+  } else {
+    retval = ((char*) slab) + kSlabHeader + slab->numBumped * slotSize;
+    slab->numBumped++;
+  }
+
+  slab->numLive++;
+  numLive++;
+
+  if (slab->freeList == NULL && slab->numBumped == slotsPerSlab) {
+    unlinkPartial(slab);
+  }
+
+  return retval;
+}
+
+void AstPool::release(void* ptr, size_t size) {
+  if (ptr == NULL) {
+    return;
+  }
+
+  if (roundUp(size, kSlotAlign) != slotSize) {
+    numOversize--;
+
+    ::operator delete(ptr);
+
+  } else {
+    Slab*     slab = slabOf(ptr);
+    FreeSlot* slot = (FreeSlot*) ptr;
+
+    slot->next     = slab->freeList;
+    slab->freeList = slot;
+
+    slab->numLive--;
+    numLive--;
+
+    if (slab->isPartial == false) {
+      linkPartial(slab);
+    }
+  }
+}
+
+void AstPool::trim() {
+  Slab* slab = partial;
+
+  while (slab != NULL) {
+    Slab* next = slab->next;
+
+    if (slab->numLive == 0) {
+      unlinkPartial(slab);
+      free(slab);
+      numSlabs--;
+    }
+
+    slab = next;
+  }
+}
+
+void AstPool::trimAll() {
+  for (AstPool* pool = sPools; pool != NULL; pool = pool->nextPool) {
+    pool->trim();
+  }
+}
+
+//
+// Report, for each pool, the number of pooled nodes and how densely the
+// slabs holding them are packed.
+//
+void AstPool::printAll(FILE* outfile) {
+  for (AstPool* pool = sPools; pool != NULL; pool = pool->nextPool) {
+    size_t capacity = pool->numSlabs * pool->slotsPerSlab;
+    int    density  = (capacity > 0) ? (int) (100 * pool->numLive / capacity)
+                                     : 0;
+
+    fprintf(outfile,
+            "    Pool %-10s live %9lu  slabs %6lu (%6luK, max %6luK)  "
+            "used %3d%%  heap %7lu\n",
+            pool->name,
+            (unsigned long) pool->numLive,
+            (unsigned long) pool->numSlabs,
+            (unsigned long) (pool->numSlabs * kSlabBytes / 1024),
+            (unsigned long) (pool->maxSlabs * kSlabBytes / 1024),
+            density,
+            (unsigned long) pool->numOversize);
+  }
+}
+
+AstPool::Slab* AstPool::newSlab() {
+  void* mem = NULL;
+
+  if (posix_memalign(&mem, kSlabBytes, kSlabBytes) != 0) {
+    throw std::bad_alloc();
+  }
+
+  Slab* slab = (Slab*) mem;
+
+  slab->prev      = NULL;
+  slab->next      = NULL;
+  slab->freeList  = NULL;
+  slab->numBumped = 0;
+  slab->numLive   = 0;
+  slab->isPartial = false;
+
+  numSlabs++;
+
+  if (numSlabs > maxSlabs) {
+    maxSlabs = numSlabs;
+  }
+
+  return slab;
+}
+
+AstPool::Slab* AstPool::slabOf(void* ptr) const {
+  return (Slab*) (((uintptr_t) ptr) & ~((uintptr_t) kSlabBytes - 1));
+}
+
+// Partially used slabs are kept at the front of the list, so that new
+// nodes fill the holes left by dead ones before touching fresh memory.
+void AstPool::linkPartial(Slab* slab) {
+  slab->prev      = NULL;
+  slab->next      = partial;
+  slab->isPartial = true;
+
+  if (partial != NULL) {
+    partial->prev = slab;
+  }
+
+  partial = slab;
+}
+
+void AstPool::unlinkPartial(Slab* slab) {
+  if (slab->prev != NULL) {
+    slab->prev->next = slab->next;
+  } else {
+    partial = slab->next;
+  }
+
+  if (slab->next != NULL) {
+    slab->next->prev = slab->prev;
+  }
+
+  slab->prev      = NULL;
+  slab->next      = NULL;
+  slab->isPartial = false;
+}
@@ -19,6 +19,7 @@
 
 #include "baseAST.h"
 
+#include "astPool.h"
 #include "astutil.h"
 #include "CForLoop.h"
 #include "CatchStmt.h"
@@ -48,6 +49,8 @@
 #include <sstream>
 #include <string>
 
+#include <sys/resource.h>
+
 //
 // declare global vectors gSymExprs, gCallExprs, gFnSymbols, ...
 //
@@ -78,9 +81,24 @@ def_vec_hash(BaseAST);
 
 #undef def_vec_hash
 
+// peak resident set size of the compiler so far, in KiB
+static long peakRSS() {
+  struct rusage usage;
+
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return -1;
+
+#ifdef __APPLE__
+  return usage.ru_maxrss / 1024;   // bytes on Mac OS X
+#else
+  return usage.ru_maxrss;
+#endif
+}
+
 //
 // Throughout printStatistics(), "n" indicates the number of nodes;
 // "k" indicates how many KiB memory they occupy: k = n * sizeof(node) / 1024.
+// "p" adds the peak RSS and the state of the AST node pools (astPool.h).
 //
 void printStatistics(const char* pass) {
   static int last_nasts = -1;
@@ -90,6 +108,7 @@ void printStatistics(const char* pass) {
     if (strstr(fPrintStatistics, "m")) {
       fprintf(stderr, "Maximum # of ASTS: %d\n", maxN);
       fprintf(stderr, "Maximum Size (KB): %d\n", maxK);
+      fprintf(stderr, "Peak RSS (KB): %ld\n", peakRSS());
     }
   }
 
@@ -160,6 +179,12 @@ void printStatistics(const char* pass) {
   if (strstr(fPrintStatistics, "k") && !strstr(fPrintStatistics, "n"))
     fprintf(stderr, "    Type %6dK Prim  %6dK Enum %6dK Class %6dK\n",
             kType, kPrimitiveType, kEnumType, kAggregateType);
+
+  if (strstr(fPrintStatistics, "p")) {
+    fprintf(stderr, "    Peak RSS %9ldK\n", peakRSS());
+    AstPool::printAll(stderr);
+  }
+
   last_nasts = nasts;
 }
 
@@ -258,6 +283,9 @@ void cleanAst() {
   // clean global vectors and delete dead ast instances
   //
   foreach_ast(clean_gvec);
+
+  // give slabs emptied by the deletions above back to the system
+  AstPool::trimAll();
 }
 
 
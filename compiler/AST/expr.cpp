@@ -24,6 +24,7 @@
 #include "expr.h"
 
 #include "alist.h"
+#include "astPool.h"
 #include "astutil.h"
 #include "AstVisitor.h"
 #include "ForLoop.h"
@@ -501,6 +502,8 @@ Expr::insertAfter(const char* format, ...) {
 *                                                                           *
 ************************************* | ************************************/
 
+DEFINE_AST_POOL(SymExpr)
+
 SymExpr::SymExpr(Symbol* init_var) :
   Expr(E_SymExpr),
   var(init_var),
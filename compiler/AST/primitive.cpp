@@ -617,6 +617,11 @@ initPrimitive() {
   // like PRIM_ASSIGN but the operation can be put off until end of
   // the enclosing task or forall.
   prim_def(PRIM_UNORDERED_ASSIGN, "unordered=", returnInfoVoid, true, true);
+  // like PRIM_UNORDERED_ASSIGN, but a remote lhs is written through the
+  // task's aggregation buffers (see chpl-comm-aggregate.h)
+  prim_def(PRIM_AGGREGATED_ASSIGN, "aggregated=", returnInfoVoid, true, true);
+  prim_def(PRIM_AGGREGATED_ADD_ASSIGN, "aggregated+=", returnInfoVoid,
+           true, true);
   prim_def(PRIM_ADD_ASSIGN, "+=", returnInfoVoid, true);
   prim_def(PRIM_SUBTRACT_ASSIGN, "-=", returnInfoVoid, true);
   prim_def(PRIM_MULT_ASSIGN, "*=", returnInfoVoid, true);
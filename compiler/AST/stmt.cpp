@@ -19,6 +19,7 @@
 
 #include "stmt.h"
 
+#include "astPool.h"
 #include "astutil.h"
 #include "expr.h"
 #include "files.h"
@@ -62,6 +63,8 @@ bool Stmt::isStmt() const {
 *                                                                             *
 ************************************** | *************************************/
 
+DEFINE_AST_POOL(BlockStmt)
+
 BlockStmt::BlockStmt(Expr* initBody, BlockTag initBlockTag) :
   Stmt(E_BlockStmt) {
 
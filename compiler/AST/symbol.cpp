@@ -23,6 +23,7 @@
 
 #include "symbol.h"
 
+#include "astPool.h"
 #include "AstToText.h"
 #include "AstVisitor.h"
 #include "astutil.h"
@@ -509,6 +510,8 @@ int LcnSymbol::offset() const
 *                                                                   *
 ********************************* | ********************************/
 
+DEFINE_AST_POOL(VarSymbol)
+
 VarSymbol::VarSymbol(const char *init_name,
                      Type    *init_type) :
   LcnSymbol(E_VarSymbol, init_name, init_type),
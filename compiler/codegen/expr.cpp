@@ -4116,6 +4116,67 @@ DEFINE_PRIM(PRIM_UNORDERED_ASSIGN) {
     FORWARD_PRIM(PRIM_ASSIGN);
   }
 }
+
+// Can an aggregated operation on lhs go through the runtime aggregator?
+static bool commAggregationAvailable(Expr* lhs) {
+  return lhs->isWideRef() &&
+         !fLLVMWideOpt &&
+         !forceWidePtrsForLocal();
+}
+
+DEFINE_PRIM(PRIM_AGGREGATED_ASSIGN) {
+  Expr* lhsExpr = call->get(1);
+
+  if (!commAggregationAvailable(lhsExpr)) {
+    FORWARD_PRIM(PRIM_ASSIGN);
+    return;
+  }
+
+  // chpl_comm_put_aggregated(void* addr, c_nodeid_t node, void* raddr,
+  //                          size_t size, int ln, int32_t fn);
+  GenRet dst = call->get(1);
+  GenRet src = call->get(2);
+  GenRet ln = call->get(3);
+  GenRet fn = call->get(4);
+  TypeSymbol* dt = lhsExpr->getValType()->symbol;
+
+  codegenCall("chpl_comm_put_aggregated",
+              codegenCastToVoidStar(codegenValuePtr(src)),
+              codegenRnode(dst),
+              codegenRaddr(dst),
+              codegenSizeof(dt->typeInfo()),
+              ln,
+              fn);
+}
+
+DEFINE_PRIM(PRIM_AGGREGATED_ADD_ASSIGN) {
+  Expr* lhsExpr = call->get(1);
+  Expr* rhsExpr = call->get(2);
+
+  if (!commAggregationAvailable(lhsExpr) || rhsExpr->isRefOrWideRef()) {
+    FORWARD_PRIM(PRIM_ADD_ASSIGN);
+    return;
+  }
+
+  // chpl_comm_add_aggregated_<type>(c_nodeid_t node, void* raddr,
+  //                                 <type> val, int ln, int32_t fn);
+  Type*       t      = lhsExpr->getValType();
+  const char* prefix = is_int_type(t)  ? "int"  :
+                       is_uint_type(t) ? "uint" :
+                                         "real"; // real or imag
+  const char* fnName = astr("chpl_comm_add_aggregated_",
+                            prefix, istr(get_width(t)));
+  GenRet dst = call->get(1);
+  GenRet src = call->get(2);
+
+  codegenCall(fnName,
+              codegenRnode(dst),
+              codegenRaddr(dst),
+              codegenValue(src),
+              call->get(3),
+              call->get(4));
+}
+
 DEFINE_PRIM(PRIM_ADD_ASSIGN) {
     codegenOpAssign(call->get(1), call->get(2), " += ", codegenAdd);
 }
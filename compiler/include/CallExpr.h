@@ -73,6 +73,7 @@ public:
   virtual void    verify();
 
   DECLARE_COPY(CallExpr);
+  DECLARE_AST_POOL(CallExpr);
 
 
   virtual void    accept(AstVisitor* visitor);
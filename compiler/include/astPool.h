@@ -0,0 +1,100 @@
+/*
+ * Copyright 2004-2019 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _AST_POOL_H_
+#define _AST_POOL_H_
+
+#include <cstddef>
+#include <cstdio>
+
+//
+// AstPool: a slab allocator for one kind of AST node.
+//
+// The hot AST node kinds (SymExpr, CallExpr, BlockStmt, VarSymbol) are
+// created and destroyed by the million.  Allocating them one at a time
+// with the global operator new scatters them across the heap.  Instead,
+// each of these classes overloads operator new/delete (DECLARE_AST_POOL
+// in baseAST.h, DEFINE_AST_POOL below) to carve nodes out of large,
+// aligned slabs that hold only nodes of that kind.
+//
+// Slots freed by cleanAst() go back to the slab they came from, and
+// allocation prefers partially-used slabs, so surviving nodes stay
+// packed together.  Slabs that become completely empty are returned to
+// the system by trimAll(), which cleanAst() calls after each pass.
+//
+// Subclasses (e.g. LoopStmt, ShadowVarSymbol) inherit the operators but
+// have a different size; such requests fall through to the global heap.
+//
+class AstPool {
+public:
+                 AstPool(const char* name, size_t slotSize);
+
+  void*          allocate(size_t size);
+  void           release(void* ptr, size_t size);
+
+  // return completely empty slabs to the system
+  void           trim();
+
+  static void    trimAll();
+  static void    printAll(FILE* outfile);
+
+  struct         FreeSlot;
+  struct         Slab;
+
+private:
+                 AstPool();
+
+  Slab*          newSlab();
+  Slab*          slabOf(void* ptr)                                      const;
+  void           linkPartial(Slab* slab);
+  void           unlinkPartial(Slab* slab);
+
+  const char*    name;
+  size_t         slotSize;
+  size_t         slotsPerSlab;
+
+  Slab*          partial;       // slabs that still have room
+  AstPool*       nextPool;      // all pools, for trimAll/printAll
+
+  size_t         numSlabs;
+  size_t         maxSlabs;
+  size_t         numLive;
+  size_t         numOversize;   // live subclass instances on the heap
+};
+
+//
+// Define the pool and the operators prototyped by DECLARE_AST_POOL.
+// The pool is created on first use and never destroyed, so that nodes
+// deleted late in compiler shutdown can still be released into it.
+//
+#define DEFINE_AST_POOL(type)                                           \
+  static AstPool& type##Pool() {                                        \
+    static AstPool* pool = new AstPool(#type, sizeof(type));            \
+    return *pool;                                                       \
+  }                                                                     \
+                                                                        \
+  void* type::operator new(size_t size) {                               \
+    return type##Pool().allocate(size);                                 \
+  }                                                                     \
+                                                                        \
+  void type::operator delete(void* ptr, size_t size) {                  \
+    type##Pool().release(ptr, size);                                    \
+  }
+
+#endif
@@ -227,6 +227,14 @@ static inline bool isType(AstTag tag)
   }                                                                     \
   virtual type* copyInner(SymbolMap* map)
 
+//
+// prototype the allocation operators for AST node types that are
+// carved out of a per-type slab pool; see astPool.h and DEFINE_AST_POOL
+//
+#define DECLARE_AST_POOL(type)                                          \
+  static void* operator new(size_t size);                               \
+  static void  operator delete(void* ptr, size_t size)
+
 // This should be expanded verbatim and overloaded, so we don't create a map if
 // internal is false.
 // copyInner must now copy flags.
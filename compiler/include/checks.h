@@ -47,6 +47,8 @@ void check_parallel();
 void check_prune();
 void check_bulkCopyRecords();
 void check_removeUnnecessaryAutoCopyCalls();
+void check_devirtualizeCalls();
+void check_stackAllocateClasses();
 void check_inlineFunctions();
 void check_scalarReplace();
 void check_refPropagation();
@@ -67,6 +67,9 @@ extern bool fNoPrivatization;
 extern bool fNoOptimizeOnClauses;
 extern bool fNoRemoveEmptyRecords;
 extern bool fNoInferLocalFields;
+extern bool fNoNarrowFormals;
+extern bool fNoStackAllocateClasses;
+extern bool fNoDevirtualize;
 extern bool fRemoveUnreachableBlocks;
 extern bool fReplaceArrayAccessesWithRefTemps;
 extern int  optimize_on_clause_limit;
@@ -76,6 +79,10 @@ extern int  tuple_copy_limit;
 
 extern bool fNoOptimizeForallUnordered;
 extern bool fReportOptimizeForallUnordered;
+extern bool fReportAggregatedForallOps;
+extern bool fReportNarrowFormals;
+extern bool fReportStackAllocatedClasses;
+extern bool fReportDevirtualizedCalls;
 
 extern bool report_inlining;
 
@@ -139,6 +139,7 @@ class SymExpr : public Expr {
   SymExpr(Symbol* init_var);
 
   DECLARE_COPY(SymExpr);
+  DECLARE_AST_POOL(SymExpr);
 
   virtual void    replaceChild(Expr* old_ast, Expr* new_ast);
   virtual void    verify();
@@ -46,6 +46,7 @@ void createTaskFunctions();
 void cullOverReferences();
 void deadCodeElimination();
 void denormalize();
+void devirtualizeCalls();
 void docs();
 void expandExternArrayCalls();
 void flattenClasses();
@@ -72,6 +73,7 @@ void resolve();
 void resolveIntents();
 void returnStarTuplesByRefArgs();
 void scalarReplace();
+void stackAllocateClasses();
 void scopeResolve();
 void verify();
 
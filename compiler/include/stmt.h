@@ -83,6 +83,7 @@ public:
                       BlockStmt(BlockTag initBlockTag);
 
   DECLARE_COPY(BlockStmt);
+  DECLARE_AST_POOL(BlockStmt);
 
   // Interface to BaseAST
   virtual GenRet      codegen();
@@ -310,6 +310,7 @@ public:
   void verify();
   virtual void    accept(AstVisitor* visitor);
   DECLARE_SYMBOL_COPY(VarSymbol);
+  DECLARE_AST_POOL(VarSymbol);
   void replaceChild(BaseAST* old_ast, BaseAST* new_ast);
 
   virtual bool       isConstant()                              const;
@@ -266,6 +266,24 @@ void check_removeUnnecessaryAutoCopyCalls()
   // Suggestion: Ensure no unnecessary autoCopy calls.
 }
 
+void check_devirtualizeCalls()
+{
+  check_afterEveryPass();
+  check_afterNormalization();
+  check_afterCallDestructors();
+  check_afterLowerIterators();
+  check_afterResolveIntents();
+}
+
+void check_stackAllocateClasses()
+{
+  check_afterEveryPass();
+  check_afterNormalization();
+  check_afterCallDestructors();
+  check_afterLowerIterators();
+  check_afterResolveIntents();
+}
+
 void check_inlineFunctions()
 {
   check_afterEveryPass();
@@ -0,0 +1,418 @@
+/*
+ * Copyright 2004-2019 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Devirtualization of dynamic dispatch
+//
+// insertDynamicDispatchCalls() turns every call to a method that has
+// overrides into a PRIM_VIRTUAL_METHOD_CALL, which looks the function up
+// in the virtual method table using the class id of the receiver.  Such
+// calls cannot be inlined and are opaque to the back-end compiler.
+//
+// Since the whole program is available, the class ids that can exist at
+// run time are exactly those stored by a PRIM_SETCID that is still in
+// the tree.  Each PRIM_SETCID stores the class id of the static type of
+// its argument, so the set of those types is the set of dynamic types a
+// receiver can have.  This includes the parent types that an instance
+// passes through while its initializers run.
+//
+// For a virtual call whose receiver has the static type S, the possible
+// targets are the virtual method table entries of the instantiated types
+// that are S or a subclass of S:
+//
+//   - If there is a single target, the virtual call is replaced with a
+//     direct call to it.
+//
+//   - If there are a few targets, the virtual call is replaced with a
+//     series of class id tests, each guarding a direct call.  The last
+//     target needs no test, and is called directly when all of the tests
+//     fail, just as the virtual method table would have done.
+//
+//   - Otherwise the virtual call is left alone.
+//
+// The direct calls may then be inlined, or further optimized by later
+// passes such as stackAllocateClasses, and by the back-end compiler.
+//
+
+#include "passes.h"
+
+#include "astutil.h"
+#include "driver.h"
+#include "expr.h"
+#include "resolution.h"
+#include "stlUtil.h"
+#include "stmt.h"
+#include "symbol.h"
+#include "type.h"
+#include "virtualDispatch.h"
+
+#include <set>
+#include <vector>
+
+namespace {
+  // The instantiated types that share a target of a virtual call
+  struct DispatchTarget {
+    DispatchTarget(FnSymbol* fn) : fn(fn) { }
+
+    FnSymbol*                   fn;
+    std::vector<AggregateType*> types;
+  };
+}
+
+// The most targets a virtual call may have and still be devirtualized,
+// and the most class id tests that may be used to choose between them.
+static const size_t maxGuardedTargets = 2;
+static const size_t maxGuardTests     = 4;
+
+static std::vector<AggregateType*> instantiatedTypes;
+
+static void findInstantiatedTypes() {
+  std::set<AggregateType*> seen;
+
+  forv_Vec(CallExpr, call, gCallExprs) {
+    if (call->inTree() == true && call->isPrimitive(PRIM_SETCID) == true) {
+      Type* type = call->get(1)->typeInfo()->getValType();
+
+      if (AggregateType* at = toAggregateType(type)) {
+        if (seen.insert(at).second == true) {
+          instantiatedTypes.push_back(at);
+        }
+      }
+    }
+  }
+}
+
+// Do the two functions accept the same arguments, apart from 'this',
+// and return the same type?
+static bool sameSignature(FnSymbol* vFn, FnSymbol* fn) {
+  if (vFn->numFormals() != fn->numFormals() ||
+      vFn->retType      != fn->retType      ||
+      fn->_this         != fn->getFormal(1) ||
+      fn->_this->isRef() == true) {
+    return false;
+  }
+
+  for (int i = 2; i <= vFn->numFormals(); i++) {
+    ArgSymbol* vFormal = vFn->getFormal(i);
+    ArgSymbol* formal  = fn->getFormal(i);
+
+    if (vFormal->type    != formal->type ||
+        vFormal->isRef() != formal->isRef()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// The most specific static type known for the receiver, looking through
+// the coercions to a parent class that resolution added for the call.
+static Type* receiverType(Expr* recv) {
+  Type*    retval = recv->typeInfo()->getValType();
+  SymExpr* se     = toSymExpr(recv);
+
+  while (se != NULL && se->symbol()->hasFlag(FLAG_COERCE_TEMP) == true) {
+    SymExpr*  def  = se->symbol()->getSingleDef();
+    CallExpr* move = def != NULL ? toCallExpr(def->parentExpr) : NULL;
+
+    se = NULL;
+
+    if (move != NULL && move->isPrimitive(PRIM_MOVE) == true) {
+      CallExpr* cast = toCallExpr(move->get(2));
+
+      if (cast != NULL && cast->isPrimitive(PRIM_CAST) == true) {
+        se = toSymExpr(cast->get(2));
+
+      } else if (cast != NULL && cast->isNamedAstr(astr_cast) == true) {
+        se = toSymExpr(cast->get(cast->numActuals()));
+
+      } else {
+        se = toSymExpr(move->get(2));
+      }
+
+      if (se != NULL) {
+        Type* type = se->typeInfo()->getValType();
+
+        if (isSubClass(type, retval) == true) {
+          retval = type;
+        }
+      }
+    }
+  }
+
+  return retval;
+}
+
+// Find the functions that 'call' may invoke, along with the instantiated
+// types that dispatch to each of them.  Return false if they cannot be
+// determined, or if the call should be left alone.
+static bool findTargets(CallExpr* call, std::vector<DispatchTarget>& targets) {
+  FnSymbol* vFn = toFnSymbol(toSymExpr(call->get(1))->symbol());
+
+  if (vFn->_this == NULL || vFn->_this != vFn->getFormal(1)) {
+    return false;
+  }
+
+  Type*          recv     = receiverType(call->get(3));
+  AggregateType* recvType = toAggregateType(recv);
+  int            index    = virtualMethodMap.get(vFn);
+
+  if (recvType == NULL || isClass(recvType) == false) {
+    return false;
+  }
+
+  for_vector(AggregateType, at, instantiatedTypes) {
+    if (isSubClass(at, recvType) == true) {
+      Vec<FnSymbol*>* vfns   = virtualMethodTable.get(at);
+      FnSymbol*       target = NULL;
+      bool            found  = false;
+
+      if (vfns == NULL || index >= vfns->n) {
+        return false;
+      }
+
+      target = vfns->v[index];
+
+      if (sameSignature(vFn, target) == false) {
+        return false;
+      }
+
+      for (size_t i = 0; i < targets.size() && found == false; i++) {
+        if (targets[i].fn == target) {
+          targets[i].types.push_back(at);
+          found = true;
+        }
+      }
+
+      if (found == false) {
+        targets.push_back(DispatchTarget(target));
+        targets.back().types.push_back(at);
+      }
+    }
+  }
+
+  return targets.size() > 0 && targets.size() <= maxGuardedTargets;
+}
+
+// The target that is called without a class id test.  This is the one
+// that would need the most tests.
+static size_t defaultTarget(std::vector<DispatchTarget>& targets) {
+  size_t retval = 0;
+
+  for (size_t i = 1; i < targets.size(); i++) {
+    if (targets[i].types.size() > targets[retval].types.size()) {
+      retval = i;
+    }
+  }
+
+  return retval;
+}
+
+static size_t numGuardTests(std::vector<DispatchTarget>& targets) {
+  size_t defaultIndex = defaultTarget(targets);
+  size_t retval       = 0;
+
+  for (size_t i = 0; i < targets.size(); i++) {
+    if (i != defaultIndex) {
+      retval += targets[i].types.size();
+    }
+  }
+
+  return retval;
+}
+
+// Build a direct call to 'fn' with the actuals of the virtual call.  If
+// the receiver needs to be cast to the type of 'this', the cast is added
+// to the end of 'block'.
+static CallExpr* buildDirectCall(CallExpr*  call,
+                                 FnSymbol*  fn,
+                                 BlockStmt* block) {
+  CallExpr* retval = new CallExpr(fn);
+  Expr*     recv   = call->get(3);
+  Type*     type   = fn->_this->type;
+
+  if (recv->typeInfo()->getValType() == type) {
+    retval->insertAtTail(recv->copy());
+
+  } else {
+    VarSymbol* tmp  = newTemp("devirtualize_this", type);
+    CallExpr*  cast = new CallExpr(PRIM_CAST, type->symbol, recv->copy());
+
+    block->insertAtTail(new DefExpr(tmp));
+    block->insertAtTail(new CallExpr(PRIM_MOVE, tmp, cast));
+
+    retval->insertAtTail(tmp);
+  }
+
+  for (int i = 4; i <= call->numActuals(); i++) {
+    retval->insertAtTail(call->get(i)->copy());
+  }
+
+  return retval;
+}
+
+// Add a direct call to 'fn' to the end of 'block', storing the result
+// in 'ret' if there is one.
+static void addDirectCall(CallExpr*  call,
+                          FnSymbol*  fn,
+                          Symbol*    ret,
+                          BlockStmt* block) {
+  CallExpr* direct = buildDirectCall(call, fn, block);
+
+  if (ret != NULL) {
+    block->insertAtTail(new CallExpr(PRIM_MOVE, ret, direct));
+  } else {
+    block->insertAtTail(direct);
+  }
+}
+
+// Remove the class id temp computed for the virtual call, if it is no
+// longer used.
+static void removeCidTemp(Symbol* cid) {
+  SymExpr* use   = NULL;
+  int      count = 0;
+
+  for_SymbolSymExprs(se, cid) {
+    use = se;
+    count++;
+  }
+
+  if (count == 1) {
+    CallExpr* move = toCallExpr(use->parentExpr);
+
+    if (move != NULL && move->isPrimitive(PRIM_MOVE) == true) {
+      move->remove();
+      cid->defPoint->remove();
+    }
+  }
+}
+
+static void devirtualize(CallExpr* call, std::vector<DispatchTarget>& targets) {
+  Expr*   stmt = call->getStmtExpr();
+  Symbol* cid  = toSymExpr(call->get(2))->symbol();
+
+  SET_LINENO(call);
+
+  if (targets.size() == 1) {
+    BlockStmt* prelude = new BlockStmt();
+    CallExpr*  direct  = buildDirectCall(call, targets[0].fn, prelude);
+
+    stmt->insertBefore(prelude);
+    prelude->flattenAndRemove();
+
+    call->replace(direct);
+
+  } else {
+    FnSymbol*  vFn          = toFnSymbol(toSymExpr(call->get(1))->symbol());
+    size_t     defaultIndex = defaultTarget(targets);
+    VarSymbol* ret          = NULL;
+    BlockStmt* block        = new BlockStmt();
+
+    if (vFn->retType != dtVoid) {
+      ret = newTemp("devirtualize_ret", vFn->retType);
+      stmt->insertBefore(new DefExpr(ret));
+    }
+
+    stmt->insertBefore(block);
+
+    // Test the class id for each type of the other targets in turn,
+    // as lowerIterators does for the methods of iterator classes.
+    for (size_t i = 0; i < targets.size(); i++) {
+      if (i != defaultIndex) {
+        for_vector(AggregateType, at, targets[i].types) {
+          VarSymbol* test     = newTemp("devirtualize_test", dtBool);
+          BlockStmt* thenStmt = new BlockStmt();
+          BlockStmt* elseStmt = new BlockStmt();
+          CallExpr*  testCid  = new CallExpr(PRIM_TESTCID,
+                                             call->get(3)->copy(),
+                                             at->symbol);
+
+          block->insertAtTail(new DefExpr(test));
+          block->insertAtTail(new CallExpr(PRIM_MOVE, test, testCid));
+          block->insertAtTail(new CondStmt(new SymExpr(test),
+                                           thenStmt,
+                                           elseStmt));
+
+          addDirectCall(call, targets[i].fn, ret, thenStmt);
+
+          block = elseStmt;
+        }
+      }
+    }
+
+    addDirectCall(call, targets[defaultIndex].fn, ret, block);
+
+    if (ret != NULL) {
+      call->replace(new SymExpr(ret));
+    } else {
+      call->remove();
+    }
+  }
+
+  removeCidTemp(cid);
+}
+
+void devirtualizeCalls() {
+  if (fNoDevirtualize == true) {
+    return;
+  }
+
+  std::vector<std::pair<CallExpr*, std::vector<DispatchTarget> > > calls;
+
+  findInstantiatedTypes();
+
+  forv_Vec(CallExpr, call, gCallExprs) {
+    if (call->inTree()                               == true &&
+        call->isPrimitive(PRIM_VIRTUAL_METHOD_CALL) == true &&
+        call->getStmtExpr()->list                   != NULL) {
+      std::vector<DispatchTarget> targets;
+
+      if (findTargets(call, targets) == true &&
+          numGuardTests(targets)     <= maxGuardTests) {
+        calls.push_back(std::make_pair(call, targets));
+      }
+    }
+  }
+
+  for (size_t i = 0; i < calls.size(); i++) {
+    CallExpr*                    call    = calls[i].first;
+    std::vector<DispatchTarget>& targets = calls[i].second;
+
+    if (fReportDevirtualizedCalls == true) {
+      ModuleSymbol* mod = call->getModule();
+
+      if (mod->modTag == MOD_USER || developer == true) {
+        FnSymbol* vFn = toFnSymbol(toSymExpr(call->get(1))->symbol());
+
+        if (targets.size() == 1) {
+          USR_PRINT(call, "Devirtualized call to '%s'", vFn->name);
+        } else {
+          USR_PRINT(call,
+                    "Devirtualized call to '%s' with %d guarded targets",
+                    vFn->name,
+                    (int) targets.size());
+        }
+      }
+    }
+
+    devirtualize(call, targets);
+  }
+
+  instantiatedTypes.clear();
+}
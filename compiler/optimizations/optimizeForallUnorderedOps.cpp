@@ -57,6 +57,11 @@
    This handles PRIM_ASSIGN as well as several chpl_comm_atomic functions
    by converting them to unordered calls within the runtime.
 
+   Assignments of values, as well as += updates, to possibly-remote
+   references are converted to aggregated operations. These are
+   buffered per task and destination locale and sent in bulk when a
+   buffer fills or the task ends (see chpl-comm-aggregate.h).
+
    It could handle PRIM_ARRAY_SET_FIRST as well if that becomes
    important in the future.
  */
@@ -154,6 +159,13 @@ bool symbolOutlivesLoop(BlockStmt* loop, Symbol* sym,
   }
 }
 
+static bool isAggregatableAddType(Type* t) {
+  return is_int_type(t) ||
+         is_uint_type(t) ||
+         is_real_type(t) ||
+         is_imag_type(t);
+}
+
 static
 bool exprIsOptimizable(BlockStmt* loop, Expr* lastStmt,
                         LifetimeInformation* lifetimeInfo) {
@@ -164,6 +176,15 @@ bool exprIsOptimizable(BlockStmt* loop, Expr* lastStmt,
       if (lhs->getValType() == rhs->getValType()) // same type
         if (isPOD(lhs->getValType())) // no custom = overloads
           return true;
+    } else if (call->isNamed("+=") && call->numActuals() == 2) {
+      SymExpr* lhsSe = toSymExpr(call->get(1));
+      SymExpr* rhsSe = toSymExpr(call->get(2));
+      if (lhsSe && rhsSe) {
+        Type* t = lhsSe->symbol()->getValType();
+        // only the numeric += functions, which become PRIM_ADD_ASSIGN
+        if (t == rhsSe->symbol()->getValType() && isAggregatableAddType(t))
+          return true;
+      }
     } else if (FnSymbol* fn = call->resolvedFunction()) {
       if (fn->_this &&
           fn->_this->getValType()->symbol->hasFlag(FLAG_ATOMIC_TYPE)) {
@@ -742,7 +763,34 @@ static bool isOptimizableAssignStmt(Expr* stmt, BlockStmt* loop) {
   return false;
 }
 
+static bool isOptimizableAddAssignStmt(Expr* stmt, BlockStmt* loop) {
+  Symbol* lhs = NULL;
+  if (CallExpr* call = toCallExpr(stmt))
+    if (call->isPrimitive(PRIM_ADD_ASSIGN))
+      if (SymExpr* lhsSe = toSymExpr(call->get(1)))
+        if (isSymExpr(call->get(2)))
+          lhs = lhsSe->symbol();
+
+  if (lhs && lhs->isRef())
+    if (BlockStmt* defInBlock = toBlockStmt(lhs->defPoint->parentExpr))
+      if (isBlockWithinBlock(defInBlock, loop))
+        if (CallExpr* marker = findMarkerNear(stmt))
+          if (hasOptimizationFlag(marker, OPT_INFO_LHS_OUTLIVES_FORALL) &&
+              hasOptimizationFlag(marker, OPT_INFO_FLAG_NO_TASK_PRIVATE))
+            if (isAggregatableAddType(lhs->getValType()))
+              return true;
 
+  return false;
+}
+
+static void reportAggregated(CallExpr* call, const char* what) {
+  if (fReportAggregatedForallOps)
+    if (call->getModule()->modTag == MOD_USER || developer)
+      USR_PRINT(call, "Aggregated %s", what);
+}
+
+// Transform a PRIM_ASSIGN into PRIM_UNORDERED_ASSIGN or, if the
+// right-hand side is a value, PRIM_AGGREGATED_ASSIGN.
 static void transformAssignStmt(Expr* stmt) {
   CallExpr* call = toCallExpr(stmt);
 
@@ -799,9 +847,31 @@ static void transformAssignStmt(Expr* stmt) {
     call->remove();
     if (callToRemove)
       callToRemove->remove();
+
+  } else if (lhs->isRef() && rhs->isRef() == false) {
+    SET_LINENO(call);
+    reportAggregated(call, "assign");
+
+    call->insertBefore(new CallExpr(PRIM_AGGREGATED_ASSIGN, lhs, rhs));
+    call->remove();
   }
 }
 
+static void transformAddAssignStmt(Expr* stmt) {
+  CallExpr* call = toCallExpr(stmt);
+
+  INT_ASSERT(call->isPrimitive(PRIM_ADD_ASSIGN));
+
+  Expr* lhs = call->get(1)->remove();
+  Expr* rhs = call->get(1)->remove();
+
+  SET_LINENO(call);
+  reportAggregated(call, "+= update");
+
+  call->insertBefore(new CallExpr(PRIM_AGGREGATED_ADD_ASSIGN, lhs, rhs));
+  call->remove();
+}
+
 
 void optimizeForallUnorderedOps() {
 
@@ -832,6 +902,7 @@ void optimizeForallUnorderedOps() {
 
   std::vector<Expr*> atomicsToOptimize;
   std::vector<Expr*> assignsToOptimize;
+  std::vector<Expr*> addAssignsToAggregate;
 
   // Gather expressions to optimize. This is done separately from
   // doing the transformation so that the transformation itself does
@@ -850,6 +921,8 @@ void optimizeForallUnorderedOps() {
             atomicsToOptimize.push_back(lastStmt);
           else if (isOptimizableAssignStmt(lastStmt, loop))
             assignsToOptimize.push_back(lastStmt);
+          else if (isOptimizableAddAssignStmt(lastStmt, loop))
+            addAssignsToAggregate.push_back(lastStmt);
         }
       }
     }
@@ -862,4 +935,7 @@ void optimizeForallUnorderedOps() {
   for_vector(Expr, assign, assignsToOptimize) {
     transformAssignStmt(assign);
   }
+  for_vector(Expr, addAssign, addAssignsToAggregate) {
+    transformAddAssignStmt(addAssign);
+  }
 }
@@ -146,6 +146,8 @@ classifyPrimitive(CallExpr *call) {
   case PRIM_MOVE:
   case PRIM_ASSIGN:
   case PRIM_UNORDERED_ASSIGN:
+  case PRIM_AGGREGATED_ASSIGN:
+  case PRIM_AGGREGATED_ADD_ASSIGN:
   case PRIM_ADD_ASSIGN:
   case PRIM_SUBTRACT_ASSIGN:
   case PRIM_MULT_ASSIGN:
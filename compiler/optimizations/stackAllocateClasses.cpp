@@ -0,0 +1,597 @@
+/*
+ * Copyright 2004-2019 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Stack allocation of class instances that do not escape
+//
+// Every 'new C()' allocates its instance on the heap, in the '_new'
+// wrapper the compiler builds for C's initializer. When an unmanaged
+// instance is created and deleted in the same block, and nothing that
+// runs in between keeps a pointer to it, the instance can instead live
+// in the stack frame of the function that creates it.
+//
+// For such a 'new', this pass inlines the '_new' wrapper at the call and
+// replaces its 'chpl_here_alloc' with PRIM_STACK_ALLOCATE_CLASS.  The
+// matching 'delete' is replaced with a direct call to C's deinit, if it
+// has one, since the dynamic type of the instance is known to be C.
+//
+// An instance escapes if a pointer to it (or a reference into it) could
+// be used after the 'delete'.  This is checked conservatively:
+//
+//   - Pointers may be copied into local variables that are defined only
+//     once, all of which are tracked along with the original.
+//
+//   - Fields may be read and written, and the instance compared and
+//     nil-checked.
+//
+//   - Pointers may be passed to functions, including virtual methods,
+//     as long as the corresponding formal does not escape either.  This
+//     is decided by the same analysis applied to the formal, and the
+//     result is cached per formal.  Recursive calls are treated as
+//     escaping.
+//
+//   - Anything else, such as storing the pointer in a field, returning
+//     it, or passing it to a task or on-statement, is an escape.
+//
+// Because a single stack slot is used each time the 'new' runs (e.g. in
+// a loop), every use of the instance has to come after the 'new' and no
+// later than the 'delete' within the block containing both.
+//
+
+#include "passes.h"
+
+#include "astutil.h"
+#include "driver.h"
+#include "expr.h"
+#include "optimizations.h"
+#include "stlUtil.h"
+#include "stmt.h"
+#include "stringutil.h"
+#include "symbol.h"
+#include "type.h"
+#include "virtualDispatch.h"
+#include "wellknown.h"
+
+#include <map>
+#include <set>
+
+namespace {
+  struct EscapeInfo {
+    EscapeInfo(bool allowDelete) :
+      allowDelete(allowDelete),
+      returned(false),
+      deleteCall(NULL) { }
+
+    bool                 allowDelete;   // may be deleted (by its creator)
+    bool                 returned;      // is returned from the function
+    CallExpr*            deleteCall;
+    std::set<Symbol*>    aliases;
+  };
+
+  // What a function may do with the pointer passed for a formal
+  enum FormalState {
+    FORMAL_PENDING,
+    FORMAL_NO_ESCAPE,
+    FORMAL_RETURNED,    // returns it, or a reference into the instance
+    FORMAL_ESCAPES
+  };
+}
+
+static bool usesDoNotEscape(Symbol* sym, EscapeInfo& info);
+
+// Largest instance, roughly in bytes, that will be put on the stack
+static const int64_t maxStackInstanceSize = 1024;
+
+static std::map<ArgSymbol*, FormalState> formalStates;
+static std::map<FnSymbol*, bool>         newWrapperOK;
+
+static bool isDeleteCall(CallExpr* call) {
+  FnSymbol* fn = call->resolvedFunction();
+
+  return fn                          != NULL &&
+         fn->name                    == astr("chpl__delete") &&
+         fn->numFormals()            == 1 &&
+         isClass(fn->getFormal(1)->type);
+}
+
+static FormalState formalState(ArgSymbol* formal) {
+  std::map<ArgSymbol*, FormalState>::iterator it = formalStates.find(formal);
+
+  if (it != formalStates.end()) {
+    // A recursive call is assumed to let the formal escape.
+    return it->second == FORMAL_PENDING ? FORMAL_ESCAPES : it->second;
+  }
+
+  FnSymbol*   fn     = toFnSymbol(formal->defPoint->parentSymbol);
+  FormalState retval = FORMAL_ESCAPES;
+
+  formalStates[formal] = FORMAL_PENDING;
+
+  // Class formals passed by ref could be redirected by the callee.
+  if (fn->hasFlag(FLAG_EXTERN) == false &&
+      fn->hasFlag(FLAG_EXPORT) == false &&
+      (isClass(formal->type) == false || formal->isRef() == false)) {
+    EscapeInfo info(false);
+
+    if (usesDoNotEscape(formal, info) == true) {
+      retval = info.returned ? FORMAL_RETURNED : FORMAL_NO_ESCAPE;
+    }
+  }
+
+  formalStates[formal] = retval;
+
+  return retval;
+}
+
+// What may the function called by 'call' do with the pointer 'actual'?
+static FormalState actualState(CallExpr* call, SymExpr* actual) {
+  if (call->isPrimitive(PRIM_VIRTUAL_METHOD_CALL) == true) {
+    FnSymbol* vFn   = toFnSymbol(toSymExpr(call->get(1))->symbol());
+    int       index = 0;
+
+    if (actual == call->get(1) || actual == call->get(2)) {
+      return FORMAL_ESCAPES;       // the function or cid, not an actual
+    }
+
+    for (int i = 3; i <= call->numActuals(); i++) {
+      if (call->get(i) == actual) {
+        index = i - 2;
+      }
+    }
+
+    FormalState retval = formalState(vFn->getFormal(index));
+
+    // Every override has to be just as well-behaved.
+    if (Vec<FnSymbol*>* children = virtualChildrenMap.get(vFn)) {
+      forv_Vec(FnSymbol, child, *children) {
+        FormalState state = formalState(child->getFormal(index));
+
+        if (state > retval) {
+          retval = state;
+        }
+      }
+    }
+
+    return retval;
+
+  } else if (call->resolvedFunction() != NULL) {
+    return formalState(actual_to_formal(actual));
+  }
+
+  return FORMAL_ESCAPES;
+}
+
+// Is 'lhs' a local that may track another copy of the pointer?
+static bool canBeAlias(Symbol* lhs, EscapeInfo& info) {
+  VarSymbol* var = toVarSymbol(lhs);
+
+  if (var                                    == NULL  ||
+      isFnSymbol(var->defPoint->parentSymbol) == false ||
+      info.aliases.count(var)                != 0) {
+    return false;
+  }
+
+  int numDefs = 0;
+
+  for_SymbolSymExprs(se, var) {
+    if (isDefAndOrUse(se) & 1) {
+      numDefs++;
+    }
+  }
+
+  return numDefs == 1;
+}
+
+static bool useDoesNotEscape(Symbol* sym, SymExpr* se, EscapeInfo& info) {
+  CallExpr* call = toCallExpr(se->parentExpr);
+
+  if (call == NULL) {
+    return false;
+  }
+
+  CallExpr* parent = toCallExpr(call->parentExpr);
+
+  if (call->isPrimitive(PRIM_MOVE) || call->isPrimitive(PRIM_ASSIGN)) {
+    Symbol* lhs = toSymExpr(call->get(1))->symbol();
+
+    if (se == call->get(1)) {
+      // Defining the pointer itself (counted by the caller), or writing
+      // through a reference into the instance.
+      return true;
+
+    } else if (sym->isRef() && lhs->isRef() == false) {
+      return true;                 // reading a field through a reference
+
+    } else if (call->isPrimitive(PRIM_MOVE) && canBeAlias(lhs, info)) {
+      return usesDoNotEscape(lhs, info);
+    }
+
+    return false;
+
+  } else if (parent                                != NULL &&
+             (parent->isPrimitive(PRIM_MOVE) ||
+              parent->isPrimitive(PRIM_ASSIGN))    &&
+             call                                  == parent->get(2)) {
+    Symbol* lhs = toSymExpr(parent->get(1))->symbol();
+
+    switch (call->isPrimitive() ? call->primitive->tag : PRIM_UNKNOWN) {
+      case PRIM_GET_MEMBER_VALUE:
+      case PRIM_GET_SVEC_MEMBER_VALUE:
+        // Copy a field out; refs in fields would need to be tracked.
+        return se == call->get(1) && lhs->isRef() == false;
+
+      case PRIM_GET_MEMBER:
+      case PRIM_GET_SVEC_MEMBER:
+        return se                       == call->get(1) &&
+               parent->isPrimitive(PRIM_MOVE)            &&
+               canBeAlias(lhs, info)                     &&
+               usesDoNotEscape(lhs, info);
+
+      case PRIM_CAST:
+      case PRIM_DYNAMIC_CAST:
+        return parent->isPrimitive(PRIM_MOVE) &&
+               canBeAlias(lhs, info)          &&
+               usesDoNotEscape(lhs, info);
+
+      case PRIM_DEREF:
+      case PRIM_GETCID:
+      case PRIM_TESTCID:
+      case PRIM_EQUAL:
+      case PRIM_NOTEQUAL:
+      case PRIM_PTR_EQUAL:
+      case PRIM_PTR_NOTEQUAL:
+        return true;
+
+      default:
+        break;
+    }
+
+    // The result of a call that returns the pointer is another alias.
+    switch (actualState(call, se)) {
+      case FORMAL_NO_ESCAPE:
+        return true;
+
+      case FORMAL_RETURNED:
+        return parent->isPrimitive(PRIM_MOVE) &&
+               canBeAlias(lhs, info)          &&
+               usesDoNotEscape(lhs, info);
+
+      default:
+        return false;
+    }
+
+  } else if (call->isPrimitive(PRIM_SET_MEMBER) ||
+             call->isPrimitive(PRIM_SET_SVEC_MEMBER)) {
+    return se == call->get(1);
+
+  } else if (call->isPrimitive(PRIM_CHECK_NIL) ||
+             call->isPrimitive(PRIM_SETCID)) {
+    return true;
+
+  } else if (isOpEqualPrim(call)) {
+    return se == call->get(1) || sym->isRef() || isClass(sym->type) == false;
+
+  } else if (call->isPrimitive(PRIM_RETURN)) {
+    info.returned = true;
+    return true;
+
+  } else if (isDeleteCall(call) == true) {
+    if (info.allowDelete == true && info.deleteCall == NULL) {
+      info.deleteCall = call;
+      return true;
+    }
+
+    return false;
+  }
+
+  return actualState(call, se) != FORMAL_ESCAPES;
+}
+
+//
+// Returns true if no use of 'sym', or of the locals it is copied into,
+// lets the instance escape.  Adds 'sym' and those locals to info.aliases.
+//
+static bool usesDoNotEscape(Symbol* sym, EscapeInfo& info) {
+  info.aliases.insert(sym);
+
+  for_SymbolSymExprs(se, sym) {
+    if (useDoesNotEscape(sym, se, info) == false) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+//
+// Does the '_new' wrapper 'newFn' allocate the instance with a single
+// 'chpl_here_alloc', and only initialize and return it?
+//
+static bool isSimpleNewWrapper(FnSymbol* newFn) {
+  std::map<FnSymbol*, bool>::iterator it = newWrapperOK.find(newFn);
+
+  if (it != newWrapperOK.end()) {
+    return it->second;
+  }
+
+  CallExpr* move   = NULL;
+  int       allocs = 0;
+  bool      retval = false;
+
+  std::vector<CallExpr*> calls;
+  collectCallExprs(newFn->body, calls);
+
+  for_vector(CallExpr, call, calls) {
+    if (call->resolvedFunction() == gChplHereAlloc) {
+      move = toCallExpr(call->parentExpr);
+      allocs++;
+    }
+  }
+
+  if (allocs                          == 1    &&
+      move                            != NULL &&
+      move->isPrimitive(PRIM_MOVE)    == true &&
+      move->parentExpr                == newFn->body) {
+    EscapeInfo info(false);
+
+    retval = usesDoNotEscape(toSymExpr(move->get(1))->symbol(), info);
+  }
+
+  newWrapperOK[newFn] = retval;
+
+  return retval;
+}
+
+//
+// A rough estimate of the size of a value of type 't', enough to keep
+// big instances (e.g. ones with large tuple fields) off task stacks.
+//
+static int64_t valueSize(Type* t) {
+  AggregateType* at     = toAggregateType(t);
+  int64_t        retval = 8;
+
+  if (at != NULL && at->symbol->hasFlag(FLAG_C_ARRAY) == true) {
+    retval = maxStackInstanceSize + 1;
+
+  } else if (at != NULL && (isRecord(at) == true || isUnion(at) == true)) {
+    retval = 0;
+
+    for_fields(field, at) {
+      retval += valueSize(field->type);
+    }
+  }
+
+  return retval;
+}
+
+static int64_t instanceSize(AggregateType* at) {
+  int64_t retval = 8;              // the cid
+
+  for_fields(field, at) {
+    if (field->hasFlag(FLAG_SUPER_CLASS) == true) {
+      retval += instanceSize(toAggregateType(field->type));
+    } else {
+      retval += valueSize(field->type);
+    }
+  }
+
+  return retval;
+}
+
+static bool isNewWrapperCall(CallExpr* call) {
+  FnSymbol* fn = call->resolvedFunction();
+
+  if (fn == NULL || fn->name != astrNew) {
+    return false;
+  }
+
+  AggregateType* at = toAggregateType(fn->retType);
+
+  return at                                   != NULL  &&
+         isClass(at)                          == true  &&
+         at->symbol->hasFlag(FLAG_EXTERN)     == false &&
+         at->symbol->hasFlag(FLAG_DATA_CLASS) == false &&
+         instanceSize(at)                     <= maxStackInstanceSize;
+}
+
+// Returns the statement in 'block' that contains 'expr', if any.
+static Expr* stmtInBlock(Expr* expr, BlockStmt* block) {
+  while (expr != NULL && expr->parentExpr != block) {
+    expr = expr->parentExpr;
+  }
+
+  return expr;
+}
+
+// Is 'expr' within 'block', strictly after 'first' and no later than 'last'?
+static bool isBetween(Expr* expr, BlockStmt* block, Expr* first, Expr* last) {
+  Expr* stmt = stmtInBlock(expr, block);
+
+  if (stmt == NULL || stmt == first) {
+    return false;
+  }
+
+  for (Expr* e = first->next; e != NULL; e = e->next) {
+    if (e == stmt) return true;
+    if (e == last) return false;
+  }
+
+  return false;
+}
+
+//
+// Can the instance allocated by 'call' (a '_new' call whose result is
+// moved into a local) live on the stack?  If so, return the 'delete'.
+//
+static CallExpr* findStackAllocatable(CallExpr* call) {
+  CallExpr* move = toCallExpr(call->parentExpr);
+
+  if (move == NULL || move->isPrimitive(PRIM_MOVE) == false) {
+    return NULL;
+  }
+
+  Symbol*    lhs   = toSymExpr(move->get(1))->symbol();
+  BlockStmt* block = toBlockStmt(move->parentExpr);
+
+  if (block                                        == NULL  ||
+      isFnSymbol(move->parentSymbol)               == false ||
+      isSimpleNewWrapper(call->resolvedFunction()) == false) {
+    return NULL;
+  }
+
+  EscapeInfo info(true);
+
+  if (canBeAlias(lhs, info)       == false ||
+      usesDoNotEscape(lhs, info)  == false ||
+      info.returned               == true  ||
+      info.deleteCall             == NULL) {
+    return NULL;
+  }
+
+  Expr* deleteStmt = info.deleteCall->getStmtExpr();
+
+  if (deleteStmt->parentExpr != block) {
+    return NULL;
+  }
+
+  // The instance's deinit will be called directly.
+  AggregateType* at = toAggregateType(call->resolvedFunction()->retType);
+
+  if (FnSymbol* deinitFn = at->getDestructor()) {
+    ArgSymbol* _this = toArgSymbol(deinitFn->_this);
+
+    if (_this == NULL || formalState(_this) != FORMAL_NO_ESCAPE) {
+      return NULL;
+    }
+  }
+
+  for_set(Symbol, alias, info.aliases) {
+    if (isBetween(alias->defPoint, block, move, deleteStmt) == false &&
+        alias->defPoint->parentExpr != block) {
+      return NULL;
+    }
+
+    for_SymbolSymExprs(se, alias) {
+      if (se->parentExpr != move &&
+          isBetween(se, block, move, deleteStmt) == false) {
+        return NULL;
+      }
+    }
+  }
+
+  return info.deleteCall;
+}
+
+static void stackAllocate(CallExpr* call, CallExpr* deleteCall) {
+  SET_LINENO(call);
+
+  FnSymbol*      newFn = call->resolvedFunction();
+  AggregateType* at    = toAggregateType(newFn->retType);
+  Expr*          stmt  = call->getStmtExpr();
+  BlockStmt*     body  = copyFnBodyForInlining(call, newFn, stmt);
+
+  // Allocate the instance in the caller's frame instead of on the heap.
+  std::vector<CallExpr*> calls;
+  collectCallExprs(body, calls);
+
+  for_vector(CallExpr, alloc, calls) {
+    if (alloc->resolvedFunction() == gChplHereAlloc) {
+      SET_LINENO(alloc);
+
+      CallExpr* stackAlloc = new CallExpr(PRIM_STACK_ALLOCATE_CLASS,
+                                          at->symbol);
+
+      alloc->replace(new CallExpr(PRIM_CAST, dtCVoidPtr->symbol, stackAlloc));
+    }
+  }
+
+  // Inline the '_new' wrapper, as inlineFunctions() would.
+  for_alist(copy, body->body) {
+    if (copy->next != NULL) {
+      if (DefExpr* def = toDefExpr(copy)) {
+        if (LabelSymbol* label = toLabelSymbol(def->sym)) {
+          label->removeFlag(FLAG_EPILOGUE_LABEL);
+        }
+      }
+
+      stmt->insertBefore(copy->remove());
+
+    } else {
+      CallExpr* returnStmt = toCallExpr(copy);
+
+      call->replace(returnStmt->get(1)->remove());
+    }
+  }
+
+  // The instance is always of type 'at', so its deinit can be called
+  // without dispatch.  There's nothing to free.
+  if (FnSymbol* deinitFn = at->getDestructor()) {
+    SET_LINENO(deleteCall);
+
+    Expr* actual = deleteCall->get(1)->remove();
+
+    if (actual->typeInfo() != at) {
+      VarSymbol* tmp = newTemp("stack_deinit_tmp", at);
+
+      deleteCall->insertBefore(new DefExpr(tmp));
+      deleteCall->insertBefore(new CallExpr(PRIM_MOVE, tmp,
+                                 new CallExpr(PRIM_CAST, at->symbol, actual)));
+      actual = new SymExpr(tmp);
+    }
+
+    deleteCall->replace(new CallExpr(deinitFn, actual));
+
+  } else {
+    deleteCall->remove();
+  }
+}
+
+void stackAllocateClasses() {
+  if (fNoStackAllocateClasses == true) {
+    return;
+  }
+
+  std::vector<std::pair<CallExpr*, CallExpr*> > candidates;
+
+  forv_Vec(CallExpr, call, gCallExprs) {
+    if (call->inTree() == true && isNewWrapperCall(call) == true) {
+      if (CallExpr* deleteCall = findStackAllocatable(call)) {
+        candidates.push_back(std::make_pair(call, deleteCall));
+      }
+    }
+  }
+
+  for (size_t i = 0; i < candidates.size(); i++) {
+    CallExpr* call = candidates[i].first;
+
+    if (fReportStackAllocatedClasses == true) {
+      ModuleSymbol* mod = call->getModule();
+
+      if (mod->modTag == MOD_USER || developer == true) {
+        USR_PRINT(call, "Stack allocated instance of class '%s'",
+                  call->resolvedFunction()->retType->symbol->name);
+      }
+    }
+
+    stackAllocate(call, candidates[i].second);
+  }
+
+  formalStates.clear();
+  newWrapperOK.clear();
+}
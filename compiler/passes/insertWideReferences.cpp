@@ -162,6 +162,12 @@
 //   I (benharsh) think that duplicating some of these functions may result
 //   in fewer wide variables, at the cost of a larger code size.
 //
+//   Functions are now cloned for callers that pass wide actuals to narrow
+//   formals (see formalForWideActual), so the other callers keep a narrow
+//   version. Clones are only made for directly-called, small functions, and
+//   a clone is shared by all of its callers regardless of which formals
+//   they pass wide values to.
+//
 // - Const global and const member forwarding
 //
 // - On-statements:
@@ -192,6 +198,7 @@
 #include "stringutil.h"
 #include "timer.h"
 #include "view.h"
+#include "virtualDispatch.h"
 #include "wellknown.h"
 
 #include <map>
@@ -993,6 +1000,223 @@ static void addKnownWides() {
   }
 }
 
+//
+// Cloning functions for wide actuals
+//
+// If one call to a function passes a wide actual, the matching formal would
+// otherwise have to be wide for every caller, along with everything in the
+// function that the formal flows into. Instead, calls that pass wide actuals
+// to narrow formals are redirected to a copy of the function whose formals
+// are widened as needed, and the original keeps the narrow formals for the
+// callers that only ever pass local values (e.g. new objects, privatized
+// instances, or the results of local accesses).
+//
+// Each function is cloned at most once, and clones are not cloned again.
+//
+
+// Functions larger than this (in calls, after inlining) are not cloned.
+// A 9-point stencil over a 2D array is about 700 calls.
+static const int maxWideCloneSize = 1000;
+
+static std::map<FnSymbol*, FnSymbol*> wideClones;     // original -> clone
+static std::set<FnSymbol*>            wideCloneSet;
+static std::map<FnSymbol*, bool>      canCloneCache;
+
+static void addTupleDefsUses(CallExpr* call);
+
+static bool canCloneForWideActuals(FnSymbol* fn) {
+  std::map<FnSymbol*, bool>::iterator it = canCloneCache.find(fn);
+  if (it != canCloneCache.end()) {
+    return it->second;
+  }
+
+  bool retval = fNoNarrowFormals == false;
+
+  if (retval) {
+    // Functions called through the ftable, virtual dispatch, or the
+    // runtime already have wide formals, or cannot have their calls
+    // redirected.
+    if (fn->hasFlag(FLAG_EXTERN) ||
+        fn->hasFlag(FLAG_EXPORT) ||
+        fn->hasFlag(FLAG_VIRTUAL) ||
+        fn->hasFlag(FLAG_LOCAL_ARGS) ||
+        fn->hasFlag(FLAG_ON_BLOCK) ||
+        fn->hasFlag(FLAG_BEGIN_BLOCK) ||
+        fn->hasFlag(FLAG_COBEGIN_OR_COFORALL_BLOCK)) {
+      retval = false;
+    }
+  }
+
+  if (retval) {
+    forv_Vec(FnSymbol, indirectlyCalledFn, ftableVec) {
+      if (fn == indirectlyCalledFn) {
+        retval = false;
+        break;
+      }
+    }
+  }
+
+  if (retval) {
+    // Every mention of 'fn' has to be a call that we can redirect.
+    for_SymbolSymExprs(se, fn) {
+      CallExpr* call = toCallExpr(se->parentExpr);
+      if (call == NULL || call->baseExpr != se) {
+        retval = false;
+        break;
+      }
+    }
+  }
+
+  if (retval) {
+    // Cloning only helps if some other call can keep using the original.
+    int numCalls = 0;
+    forv_Vec(CallExpr, call, *fn->calledBy) {
+      if (isAlive(call)) numCalls++;
+    }
+
+    std::vector<CallExpr*> calls;
+    collectCallExprs(fn->body, calls);
+
+    retval = numCalls > 1 && (int)calls.size() <= maxWideCloneSize;
+  }
+
+  canCloneCache[fn] = retval;
+
+  return retval;
+}
+
+//
+// Create the clone of 'fn' that takes wide actuals, and add what it
+// contains to the def/use maps and calledBy vectors that propagation
+// relies on.
+//
+static FnSymbol* buildWideClone(FnSymbol* fn) {
+  SET_LINENO(fn);
+
+  FnSymbol* clone = fn->copy();
+  clone->cname = astr("_wide_", fn->cname);
+  fn->defPoint->insertAfter(new DefExpr(clone));
+
+  clone->calledBy = new Vec<CallExpr*>();
+  downstreamFromOn[clone] = downstreamFromOn[fn];
+
+  std::vector<SymExpr*> symExprs;
+  collectSymExprs(clone, symExprs);
+  for_vector(SymExpr, se, symExprs) {
+    if (isLcnSymbol(se->symbol())) {
+      int result = isDefAndOrUse(se);
+      if (result & 1) addDef(defMap, se);
+      if (result & 2) addUse(useMap, se);
+    }
+  }
+
+  std::vector<CallExpr*> calls;
+  collectCallExprs(clone, calls);
+  for_vector(CallExpr, call, calls) {
+    if (FnSymbol* callee = call->resolvedFunction()) {
+      callee->calledBy->add(call);
+    } else if (call->isPrimitive(PRIM_VIRTUAL_METHOD_CALL)) {
+      FnSymbol* vFn = toFnSymbol(toSymExpr(call->get(1))->symbol());
+      vFn->calledBy->add(call);
+      if (Vec<FnSymbol*>* children = virtualChildrenMap.get(vFn)) {
+        forv_Vec(FnSymbol, child, *children) {
+          child->calledBy->add(call);
+        }
+      }
+    } else {
+      addTupleDefsUses(call);
+    }
+  }
+
+  // The clone starts out exactly as wide as the original is now. Propagate
+  // that wideness again so that the clone's callers match it.
+  std::vector<DefExpr*> defs;
+  collectDefExprs(clone, defs);
+  for_vector(DefExpr, def, defs) {
+    if (isLcnSymbol(def->sym)) {
+      addToQueue(def->sym);
+    }
+  }
+
+  wideClones[fn] = clone;
+  wideCloneSet.insert(clone);
+
+  return clone;
+}
+
+//
+// Return the formal that a wide 'actual' must be matched against. If that
+// formal is still narrow, 'actual's call is first redirected to the wide
+// clone of its function so that the original's formal can stay narrow.
+//
+static ArgSymbol* formalForWideActual(SymExpr* actual) {
+  ArgSymbol* arg  = actual_to_formal(actual);
+  CallExpr*  call = toCallExpr(actual->parentExpr);
+  FnSymbol*  fn   = call->resolvedFunction();
+
+  if (hasSomeWideness(arg) ||
+      !typeCanBeWide(arg) ||
+      wideCloneSet.count(fn) != 0 ||
+      !canCloneForWideActuals(fn)) {
+    return arg;
+  }
+
+  FnSymbol* clone = NULL;
+  std::map<FnSymbol*, FnSymbol*>::iterator it = wideClones.find(fn);
+  if (it != wideClones.end()) {
+    clone = it->second;
+  } else {
+    clone = buildWideClone(fn);
+  }
+
+  debug(actual, "redirecting call %d to wide clone %s (%d)\n", call->id, clone->cname, clone->id);
+
+  SET_LINENO(call);
+
+  int index = fn->calledBy->index(call);
+  if (index >= 0) {
+    fn->calledBy->remove(index);
+  }
+  call->baseExpr->replace(new SymExpr(clone));
+  clone->calledBy->add(call);
+
+  // The clone may already be wider than this call expects. Propagate its
+  // return value and formals again so that the call matches.
+  for_formals(formal, clone) {
+    addToQueue(formal);
+  }
+  if (clone->retType != dtVoid) {
+    addToQueue(clone->getReturnSymbol());
+  }
+
+  return actual_to_formal(actual);
+}
+
+static void reportNarrowFormals() {
+  forv_Vec(FnSymbol, fn, gFnSymbols) {
+    std::map<FnSymbol*, FnSymbol*>::iterator it = wideClones.find(fn);
+    if (it == wideClones.end()) continue;
+    if (fn->getModule()->modTag != MOD_USER && !developer) continue;
+    if (isTaskFun(fn) && !developer) continue;
+
+    FnSymbol* clone = it->second;
+    int numNarrow = 0;
+    forv_Vec(CallExpr, call, *fn->calledBy) {
+      if (isAlive(call)) numNarrow++;
+    }
+    if (numNarrow == 0) continue;
+
+    for (int i = 1; i <= fn->numFormals(); i++) {
+      ArgSymbol* formal = fn->getFormal(i);
+      if (!hasSomeWideness(formal) && hasSomeWideness(clone->getFormal(i))) {
+        USR_PRINT(formal, "formal '%s' of '%s' kept narrow for %d of %d calls",
+                  formal->name, fn->name, numNarrow,
+                  numNarrow + clone->calledBy->n);
+      }
+    }
+  }
+}
+
 //
 // Based on how the wide variable 'sym' is used, this function will
 // widen other variables.
@@ -1224,9 +1448,7 @@ static void propagateVar(Symbol* sym) {
       else if (FnSymbol* fn = call->resolvedFunction()) {
         debug(sym, "passed to fn %s (%d)\n", fn->cname, fn->id);
 
-        // TODO: Duplicate functions here.
-
-        ArgSymbol* arg = actual_to_formal(use);
+        ArgSymbol* arg = formalForWideActual(use);
         debug(sym, "Default widening of arg %s (%d)\n", arg->cname, arg->id);
         matchWide(use, arg);
       }
@@ -1238,9 +1460,8 @@ static void propagateVar(Symbol* sym) {
     if (CallExpr* call = toCallExpr(def->parentExpr)) {
       if (call->isResolved()) {
         debug(sym, "Widening def arg\n");
-        ArgSymbol* arg = actual_to_formal(def);
-        if (arg->hasFlag(FLAG_RETARG) == false) {
-          matchWide(def, arg);
+        if (actual_to_formal(def)->hasFlag(FLAG_RETARG) == false) {
+          matchWide(def, formalForWideActual(def));
         }
       }
       else if (call->isPrimitive(PRIM_MOVE) || call->isPrimitive(PRIM_ASSIGN)) {
@@ -1766,6 +1987,8 @@ static void localizeCall(CallExpr* call) {
     case PRIM_ADD_ASSIGN:
     case PRIM_SUBTRACT_ASSIGN:
     case PRIM_DIV_ASSIGN:
+    case PRIM_AGGREGATED_ASSIGN:
+    case PRIM_AGGREGATED_ADD_ASSIGN:
       if (isFullyWide(call->get(1))) {
         insertLocalTemp(call->get(1));
       }
@@ -2260,35 +2483,39 @@ static void addTupleDefOrUse(Map<Symbol*, Vec<SymExpr*>*>& ses, Symbol* field, E
 // buildDefUseMaps does not handle tuple fields correctly, star tuples
 // especially. This function tries to do a better job.
 //
-static void buildTupleDefsUses() {
-  // TODO: The incorrect defs/uses from buildDefUseMaps may still
-  // exist, can we do anything about that?
-  forv_Vec(CallExpr, call, gCallExprs) {
-    if (call->isPrimitive(PRIM_GET_SVEC_MEMBER) ||
-        call->isPrimitive(PRIM_GET_SVEC_MEMBER_VALUE) ||
-        call->isPrimitive(PRIM_SET_SVEC_MEMBER)) {
-      Symbol* field = getSvecSymbol(call);
-      if (field) {
+static void addTupleDefsUses(CallExpr* call) {
+  if (call->isPrimitive(PRIM_GET_SVEC_MEMBER) ||
+      call->isPrimitive(PRIM_GET_SVEC_MEMBER_VALUE) ||
+      call->isPrimitive(PRIM_SET_SVEC_MEMBER)) {
+    Symbol* field = getSvecSymbol(call);
+    if (field) {
+      if (call->isPrimitive(PRIM_SET_SVEC_MEMBER)) {
+        addTupleDefOrUse(defMap, field, call->get(2));
+      } else {
+        addTupleDefOrUse(useMap, field, call->get(2));
+      }
+    } else {
+      // indexed by a runtime value, need to add all fields.
+      AggregateType* ag = toAggregateType(call->get(1)->getValType());
+      for_fields(fi, ag) {
         if (call->isPrimitive(PRIM_SET_SVEC_MEMBER)) {
-          addTupleDefOrUse(defMap, field, call->get(2));
+          addTupleDefOrUse(defMap, fi, call->get(2));
         } else {
-          addTupleDefOrUse(useMap, field, call->get(2));
-        }
-      } else {
-        // indexed by a runtime value, need to add all fields.
-        AggregateType* ag = toAggregateType(call->get(1)->getValType());
-        for_fields(fi, ag) {
-          if (call->isPrimitive(PRIM_SET_SVEC_MEMBER)) {
-            addTupleDefOrUse(defMap, fi, call->get(2));
-          } else {
-            addTupleDefOrUse(useMap, fi, call->get(2));
-          }
+          addTupleDefOrUse(useMap, fi, call->get(2));
         }
       }
     }
   }
 }
 
+static void buildTupleDefsUses() {
+  // TODO: The incorrect defs/uses from buildDefUseMaps may still
+  // exist, can we do anything about that?
+  forv_Vec(CallExpr, call, gCallExprs) {
+    addTupleDefsUses(call);
+  }
+}
+
 void handleIsWidePointer() {
   forv_Vec(CallExpr, call, gCallExprs) {
     if (call->isPrimitive(PRIM_IS_WIDE_PTR)) {
@@ -2517,6 +2744,10 @@ insertWideReferences(void) {
     fixRecordWrappedTypes();
   }
 
+  if (fReportNarrowFormals) {
+    reportNarrowFormals();
+  }
+
   // IWR
   insertStringLiteralTemps();
   narrowWideClassesThroughCalls();
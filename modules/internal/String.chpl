@@ -138,6 +138,10 @@ module String {
   // Growth factor to use when extending the buffer for appends
   private config param chpl_stringGrowthFactor = 1.5;
 
+  // Strings at least this long get a reference-counted buffer that
+  // copies on the same locale share instead of duplicating
+  private config param chpl_stringShareMinLen = 64;
+
   //
   // Externs and constants used to implement strings
   //
@@ -179,6 +183,26 @@ module String {
   pragma "fn synchronization free"
   private extern proc qio_nbytes_char(chr:int(32)):c_int;
 
+  // Search and classification kernels from chpl-string-support.c
+  pragma "fn synchronization free"
+  private extern proc chpl_string_find(s: bufferType, len: int,
+                                       needle: bufferType,
+                                       needleLen: int): int;
+  pragma "fn synchronization free"
+  private extern proc chpl_string_rfind(s: bufferType, len: int,
+                                        needle: bufferType,
+                                        needleLen: int): int;
+  pragma "fn synchronization free"
+  private extern proc chpl_string_count(s: bufferType, len: int,
+                                        needle: bufferType,
+                                        needleLen: int): int;
+  pragma "fn synchronization free"
+  private extern proc chpl_string_all_ascii_digits(s: bufferType,
+                                                   len: int): c_int;
+  pragma "fn synchronization free"
+  private extern proc chpl_string_all_ascii_spaces(s: bufferType,
+                                                   len: int): c_int;
+
   pragma "no doc"
   extern const CHPL_SHORT_STRING_SIZE : c_int;
 
@@ -194,6 +218,28 @@ module String {
   pragma "no doc"
   extern proc chpl__getInPlaceBufferDataForWrite(ref data : chpl__inPlaceBuffer) : c_ptr(uint(8));
 
+  // Reference counts for shared buffers, from chpl-string.c
+  pragma "fn synchronization free"
+  private extern proc chpl_string_shared_hdr_size(): int;
+  pragma "fn synchronization free"
+  private extern proc chpl_string_shared_init(buf: bufferType);
+  pragma "fn synchronization free"
+  private extern proc chpl_string_shared_retain(buf: bufferType);
+  pragma "fn synchronization free"
+  private extern proc chpl_string_shared_release(buf: bufferType): bool;
+  pragma "fn synchronization free"
+  private extern proc chpl_string_shared_unique(buf: bufferType): bool;
+
+  // Free an owned buffer, or drop one reference to it if it is shared.
+  // Must be called on the locale the buffer lives on.
+  private proc releaseBuffer(buf: bufferType, refcounted: bool) {
+    if !refcounted {
+      chpl_here_free(buf);
+    } else if chpl_string_shared_release(buf) {
+      chpl_here_free(buf - chpl_string_shared_hdr_size());
+    }
+  }
+
   private inline proc chpl_string_comm_get(dest: bufferType, src_loc_id: int(64),
                                            src_addr: bufferType, len: integral) {
     __primitive("chpl_comm_get", dest, src_loc_id, src_addr, len.safeCast(size_t));
@@ -303,6 +349,8 @@ module String {
     pragma "no doc"
     var isowned: bool = true;
     pragma "no doc"
+    var refcounted: bool = false; // buff is shared with copies; see _newBuffer
+    pragma "no doc"
     // We use chpl_nodeID as a shortcut to get at here.id without actually constructing
     // a locale object. Used when determining if we should make a remote transfer.
     var locale_id = chpl_nodeID; // : chpl_nodeID_t
@@ -350,7 +398,25 @@ module String {
     }
 
     proc init=(s: string) {
-      this.init(s);
+      this.complete();
+      const sLen = s.len;
+      if sLen == 0 then return;
+
+      this.len = sLen;
+      if !_local && s.locale_id != chpl_nodeID {
+        this.buff = copyRemoteBuffer(s.locale_id, s.buff, sLen);
+        this._size = sLen+1;
+      } else if s.refcounted {
+        // Share the buffer rather than copying it
+        chpl_string_shared_retain(s.buff);
+        this.buff = s.buff;
+        this._size = s._size;
+        this.refcounted = true;
+      } else {
+        this._newBuffer(sLen);
+        c_memcpy(this.buff, s.buff, sLen);
+        this.buff[sLen] = 0;
+      }
     }
 
     /*
@@ -397,13 +463,56 @@ module String {
       // initialized from a c_string allocated from memory but beginning with
       // a null-terminator.
       if isowned && this.buff != nil {
+        const buff = this.buff, refcounted = this.refcounted;
         on __primitive("chpl_on_locale_num",
                        chpl_buildLocaleID(this.locale_id, c_sublocid_any)) {
-          chpl_here_free(this.buff);
+          releaseBuffer(buff, refcounted);
         }
       }
     }
 
+    // Give this string a new owned buffer with room for len bytes and a
+    // terminating NUL, without freeing any buffer it has now.  Long
+    // strings get a reference-counted buffer, so that copies of them
+    // can share it.  The buffer is never smaller than minSize bytes.
+    pragma "no doc"
+    proc ref _newBuffer(len: int, minSize: int = 0) {
+      if len >= chpl_stringShareMinLen {
+        const hdrSize = chpl_string_shared_hdr_size();
+        const allocSize = chpl_here_good_alloc_size(
+                            hdrSize + max(len+1, minSize));
+        const base = chpl_here_alloc(allocSize,
+                                     offset_STR_COPY_DATA): bufferType;
+        this.buff = base + hdrSize;
+        this._size = allocSize - hdrSize;
+        this.refcounted = true;
+        chpl_string_shared_init(this.buff);
+      } else {
+        const allocSize = chpl_here_good_alloc_size(max(len+1, minSize));
+        this.buff = chpl_here_alloc(allocSize,
+                                    offset_STR_COPY_DATA): bufferType;
+        this._size = allocSize;
+        this.refcounted = false;
+      }
+      this.isowned = true;
+    }
+
+    // Make this string share the buffer of s, which must be
+    // reference-counted and on this locale.  Assumed to be called from
+    // this.locale.
+    pragma "no doc"
+    proc ref _shareBuffer(const ref s: string) {
+      if this.buff == s.buff then return;
+      chpl_string_shared_retain(s.buff);
+      if this.isowned && !this.isEmpty() then
+        releaseBuffer(this.buff, this.refcounted);
+      this.buff = s.buff;
+      this._size = s._size;
+      this.len = s.len;
+      this.isowned = true;
+      this.refcounted = true;
+    }
+
     pragma "no doc"
     proc chpl__serialize() {
       var data : chpl__inPlaceBuffer;
@@ -439,32 +548,32 @@ module String {
       // allowed to (this.isowned == true)
       if s_len != 0 {
         if needToCopy {
-          if !this.isowned || s_len+1 > this._size {
-            // If the new string is too big for our current buffer or we dont
-            // own our current buffer then we need a new one.
+          if !this.isowned || s_len+1 > this._size ||
+             (this.refcounted && !chpl_string_shared_unique(this.buff)) {
+            // If the new string is too big for our current buffer, or we
+            // dont own our current buffer or share it with copies, then we
+            // need a new one.
             if this.isowned && !this.isEmpty() then
-              chpl_here_free(this.buff);
+              releaseBuffer(this.buff, this.refcounted);
             // TODO: should I just allocate 'size' bytes?
-            const allocSize = chpl_here_good_alloc_size(s_len+1);
-            this.buff = chpl_here_alloc(allocSize,
-                                       offset_STR_COPY_DATA):bufferType;
-            this._size = allocSize;
-            // We just allocated a buffer, make sure to free it later
-            this.isowned = true;
+            this._newBuffer(s_len);
           }
           c_memmove(this.buff, buf, s_len);
           this.buff[s_len] = 0;
         } else {
           if this.isowned && !this.isEmpty() then
-            chpl_here_free(this.buff);
+            releaseBuffer(this.buff, this.refcounted);
           this.buff = buf;
           this._size = size;
+          this.refcounted = false;
         }
       } else {
         // If s_len is 0, 'buf' may still have been allocated. Regardless, we
         // need to free the old buffer if 'this' is isowned.
-        if this.isowned && !this.isEmpty() then chpl_here_free(this.buff);
+        if this.isowned && !this.isEmpty() then
+          releaseBuffer(this.buff, this.refcounted);
         this._size = 0;
+        this.refcounted = false;
 
         // If we need to copy, we can just set 'buff' to nil. Otherwise the
         // implication is that the string takes ownership of the given buffer,
@@ -822,32 +931,37 @@ module String {
         ret = "";
       } else {
         ret.len = r2.size:int;
-        const newSize = chpl_here_good_alloc_size(ret.len+1);
-        ret._size = max(chpl_string_min_alloc_size, newSize);
-        // FIXME: I was dumb here, just copy the correct region over in
-        // multi-locale and use that as the string buffer. No need to copy stuff
-        // about after pulling it across.
-        ret.buff = chpl_here_alloc(ret._size,
-                                  offset_STR_COPY_DATA): bufferType;
-
-        var thisBuff: bufferType;
+        ret._newBuffer(ret.len, chpl_string_min_alloc_size);
+
         const remoteThis = _local == false && this.locale_id != chpl_nodeID;
-        if remoteThis {
-          // TODO: Could do an optimization here and only pull down the data
-          // between r2.low and r2.high. Indexing for the copy below gets a bit
-          // more complex when that is performed though.
-          thisBuff = copyRemoteBuffer(this.locale_id, this.buff, this.len);
+        if r2.stride == 1 {
+          // A contiguous slice is one copy, and only the bytes it spans
+          // are pulled from a remote string.
+          const src = this.buff + (r2.low:int - 1);
+          if remoteThis then
+            chpl_string_comm_get(ret.buff, this.locale_id, src, ret.len);
+          else
+            c_memcpy(ret.buff, src, ret.len);
+          ret.buff[ret.len] = 0;
         } else {
-          thisBuff = this.buff;
-        }
+          var thisBuff: bufferType;
+          if remoteThis {
+            // TODO: Could do an optimization here and only pull down the data
+            // between r2.low and r2.high. Indexing for the copy below gets a
+            // bit more complex when that is performed though.
+            thisBuff = copyRemoteBuffer(this.locale_id, this.buff, this.len);
+          } else {
+            thisBuff = this.buff;
+          }
 
-        var buff = ret.buff; // Has perf impact and our LICM can't hoist :(
-        for (r2_i, i) in zip(r2, 0..) {
-          buff[i] = thisBuff[r2_i-1];
-        }
-        buff[ret.len] = 0;
+          var buff = ret.buff; // Has perf impact and our LICM can't hoist :(
+          for (r2_i, i) in zip(r2, 0..) {
+            buff[i] = thisBuff[r2_i-1];
+          }
+          buff[ret.len] = 0;
 
-        if remoteThis then chpl_here_free(thisBuff);
+          if remoteThis then chpl_here_free(thisBuff);
+        }
       }
 
       return ret;
@@ -945,9 +1059,9 @@ module String {
 
 
     // Helper function that uses a param bool to toggle between count and find
-    //TODO: this could be a much better string search
-    //      (Boyer-Moore-Horspool|any thing other than brute force)
     //
+    // Unstrided regions are searched with the vectorized kernels in the
+    // runtime; strided ones fall back to comparing byte by byte.
     pragma "no doc"
     inline proc _search_helper(needle: string, region: range(?),
                                param count: bool, param fromLeft: bool = true) {
@@ -982,6 +1096,21 @@ module String {
           localRet = 0;
         }
 
+        if localRet == -1 && view.stride == 1 {
+          const localNeedle: string = needle.localize();
+          const low = view.low: int;
+          const viewBuff = this.buff + (low-1);
+          if count {
+            localRet = chpl_string_count(viewBuff, thisLen,
+                                         localNeedle.buff, nLen);
+          } else {
+            const off = if fromLeft
+              then chpl_string_find(viewBuff, thisLen, localNeedle.buff, nLen)
+              else chpl_string_rfind(viewBuff, thisLen, localNeedle.buff, nLen);
+            localRet = if off < 0 then 0 else low + off;
+          }
+        }
+
         if localRet == -1 {
           localRet = 0;
           const localNeedle: string = needle.localize();
@@ -1062,23 +1191,49 @@ module String {
       :returns: a copy of the string where `replacement` replaces `needle` up
                 to `count` times
      */
-    // TODO: not ideal - count and single allocation probably faster
-    //                 - can special case on replacement|needle.length (0, 1)
     proc replace(needle: string, replacement: string, count: int = -1) : string {
-      var result: string = this;
-      var found: int = 0;
-      var startIdx: int = 1;
+      const localThis: string = this.localize();
       const localNeedle: string = needle.localize();
       const localReplacement: string = replacement.localize();
-
+      const thisLen = localThis.len;
+      const nLen = localNeedle.len;
+      const rLen = localReplacement.len;
+
+      // An empty needle never matches.  Return 'this' rather than
+      // 'localThis' so that the result owns its buffer.
+      if nLen == 0 || nLen > thisLen then
+        return this;
+
+      // Count the matches first so that the result is allocated only once
+      var found = 0;
+      var pos = 0;
       while (count < 0) || (found < count) {
-        const idx = result.find(localNeedle, startIdx..);
-        if !idx then break;
-
+        const off = chpl_string_find(localThis.buff + pos, thisLen - pos,
+                                     localNeedle.buff, nLen);
+        if off < 0 then break;
         found += 1;
-        result = result[..idx-1] + localReplacement + result[(idx + localNeedle.length)..];
-        startIdx = idx + localReplacement.length;
+        pos += off + nLen;
+      }
+      if found == 0 then
+        return this;
+
+      var result: string;
+      result.len = thisLen + found * (rLen - nLen);
+      result._newBuffer(result.len);
+
+      var src = 0, dst = 0;
+      for 1..found {
+        const off = chpl_string_find(localThis.buff + src, thisLen - src,
+                                     localNeedle.buff, nLen);
+        c_memcpy(result.buff + dst, localThis.buff + src, off);
+        dst += off;
+        c_memcpy(result.buff + dst, localReplacement.buff, rLen);
+        dst += rLen;
+        src += off + nLen;
       }
+      c_memcpy(result.buff + dst, localThis.buff + src, thisLen - src);
+      result.buff[result.len] = 0;
+
       return result;
     }
 
@@ -1108,11 +1263,11 @@ module String {
         var start: int = 1;
         var done: bool = false;
         while !done  {
-          var chunk: string;
+          var chunkEnd: int;
           var end: int;
 
           if (maxsplit == 0) {
-            chunk = localThis;
+            chunkEnd = localThis.len;
             done = true;
           } else {
             if (splitAll || splitCount < maxsplit) then
@@ -1120,18 +1275,19 @@ module String {
 
             if(end == 0) {
               // Separator not found
-              chunk = localThis[start..];
+              chunkEnd = localThis.len;
               done = true;
             } else {
-              chunk = localThis[start..end-1];
+              chunkEnd = end-1;
             }
           }
 
-          if !(ignoreEmpty && chunk.isEmpty()) {
+          if !(ignoreEmpty && chunkEnd < start) {
             // Putting the yield inside the if prevents us from being inlined
             // in the zippered case, but I don't think there is any way to avoid
-            // that easily
-            yield chunk;
+            // that easily.  Yielding the slice itself rather than a variable
+            // holding it hands its buffer to the caller without a copy.
+            yield localThis[start..chunkEnd];
             splitCount += 1;
           }
           start = end+localSep.length;
@@ -1153,7 +1309,6 @@ module String {
         const localThis: string = this.localize();
         var done : bool = false;
         var yieldChunk : bool = false;
-        var chunk : string;
 
         const noSplits : bool = maxsplit == 0;
         const limitSplits : bool = maxsplit > 0;
@@ -1162,13 +1317,15 @@ module String {
 
         var inChunk : bool = false;
         var chunkStart : int;
+        var chunkEnd : int;
 
         for (c, i, nbytes) in localThis._cpIndexLen() {
           // emit whole string, unless all whitespace
           if noSplits {
             done = true;
             if !localThis.isSpace() then {
-              chunk = localThis;
+              chunkStart = 1;
+              chunkEnd = localThis.len;
               yieldChunk = true;
             }
           } else {
@@ -1178,7 +1335,7 @@ module String {
               chunkStart = i;
               inChunk = true;
               if i - 1 + nbytes > iEnd {
-                chunk = localThis[chunkStart..];
+                chunkEnd = localThis.len;
                 yieldChunk = true;
                 done = true;
               }
@@ -1188,18 +1345,18 @@ module String {
                 splitCount += 1;
                 // last split under limit
                 if limitSplits && splitCount > maxsplit {
-                  chunk = localThis[chunkStart..];
+                  chunkEnd = localThis.len;
                   yieldChunk = true;
                   done = true;
                 // no limit
                 } else {
-                  chunk = localThis[chunkStart..i-1];
+                  chunkEnd = i-1;
                   yieldChunk = true;
                   inChunk = false;
                 }
               // out of chars
               } else if i - 1 + nbytes > iEnd {
-                chunk = localThis[chunkStart..];
+                chunkEnd = localThis.len;
                 yieldChunk = true;
                 done = true;
               }
@@ -1207,7 +1364,8 @@ module String {
           }
 
           if yieldChunk {
-            yield chunk;
+            // Yield the slice itself so that its buffer goes to the caller
+            yield localThis[chunkStart..chunkEnd];
             yieldChunk = false;
           }
           if done then
@@ -1292,11 +1450,7 @@ module String {
 
         var joined: string;
         joined.len = joinedSize;
-        const allocSize = chpl_here_good_alloc_size(joined.len + 1);
-        joined._size = allocSize;
-        joined.buff = chpl_here_alloc(
-          allocSize,
-          offset_STR_COPY_DATA): bufferType;
+        joined._newBuffer(joined.len);
 
         var first = true;
         var offset = 0;
@@ -1462,10 +1616,16 @@ module String {
 
       on __primitive("chpl_on_locale_num",
                      chpl_buildLocaleID(this.locale_id, c_sublocid_any)) {
-        for cp in this.codepoints() {
-          if !(codepoint_isWhitespace(cp)) {
-            result = false;
-            break;
+        // Most strings are ASCII, which can be classified without decoding
+        const ascii = chpl_string_all_ascii_spaces(this.buff, this.len);
+        if ascii >= 0 {
+          result = ascii == 1;
+        } else {
+          for cp in this.codepoints() {
+            if !(codepoint_isWhitespace(cp)) {
+              result = false;
+              break;
+            }
           }
         }
       }
@@ -1506,10 +1666,15 @@ module String {
 
       on __primitive("chpl_on_locale_num",
                      chpl_buildLocaleID(this.locale_id, c_sublocid_any)) {
-        for cp in this.codepoints() {
-          if !codepoint_isDigit(cp) {
-            result = false;
-            break;
+        const ascii = chpl_string_all_ascii_digits(this.buff, this.len);
+        if ascii >= 0 {
+          result = ascii == 1;
+        } else {
+          for cp in this.codepoints() {
+            if !codepoint_isDigit(cp) {
+              result = false;
+              break;
+            }
           }
         }
       }
@@ -1753,7 +1918,10 @@ module String {
   proc =(ref lhs: string, rhs: string) {
     inline proc helpMe(ref lhs: string, rhs: string) {
       if _local || rhs.locale_id == chpl_nodeID {
-        lhs.reinitString(rhs.buff, rhs.len, rhs._size, needToCopy=true);
+        if rhs.refcounted then
+          lhs._shareBuffer(rhs);
+        else
+          lhs.reinitString(rhs.buff, rhs.len, rhs._size, needToCopy=true);
       } else {
         const len = rhs.len; // cache the remote copy of len
         var remote_buf:bufferType = nil;
@@ -1804,11 +1972,7 @@ module String {
 
     var ret: string;
     ret.len = s0len + s1len;
-    const allocSize = chpl_here_good_alloc_size(ret.len+1);
-    ret._size = allocSize;
-    ret.buff = chpl_here_alloc(allocSize,
-                              offset_STR_COPY_DATA): bufferType;
-    ret.isowned = true;
+    ret._newBuffer(ret.len);
 
     const s0remote = s0.locale_id != chpl_nodeID;
     if s0remote {
@@ -1850,11 +2014,7 @@ module String {
 
     var ret: string;
     ret.len = sLen * n; // TODO: check for overflow
-    const allocSize = chpl_here_good_alloc_size(ret.len+1);
-    ret._size = allocSize;
-    ret.buff = chpl_here_alloc(allocSize,
-                              offset_STR_COPY_DATA): bufferType;
-    ret.isowned = true;
+    ret._newBuffer(ret.len);
 
     const sRemote = s.locale_id != chpl_nodeID;
     if sRemote {
@@ -1987,19 +2147,25 @@ module String {
                    chpl_buildLocaleID(lhs.locale_id, c_sublocid_any)) {
       const rhsLen = rhs.len;
       const newLength = lhs.len+rhsLen; //TODO: check for overflow
-      if lhs._size <= newLength {
+      // Copies may be reading a shared buffer, so don't append in place
+      const lhsShared = lhs.refcounted &&
+                        !chpl_string_shared_unique(lhs.buff);
+      if lhs._size <= newLength || lhsShared {
         const newSize = chpl_here_good_alloc_size(
             max(newLength+1, lhs.len*chpl_stringGrowthFactor):int);
 
-        if lhs.isowned {
+        if lhs.isowned && !lhs.refcounted {
           lhs.buff = chpl_here_realloc(lhs.buff, newSize,
                                       offset_STR_COPY_DATA):bufferType;
         } else {
           var newBuff = chpl_here_alloc(newSize,
                                        offset_STR_COPY_DATA):bufferType;
           c_memcpy(newBuff, lhs.buff, lhs.len);
+          if lhs.isowned then
+            releaseBuffer(lhs.buff, lhs.refcounted);
           lhs.buff = newBuff;
           lhs.isowned = true;
+          lhs.refcounted = false;
         }
 
         lhs._size = newSize;
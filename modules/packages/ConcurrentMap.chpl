@@ -0,0 +1,553 @@
+/*
+ * Copyright 2004-2019 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+  This module provides :class:`ConcurrentMap`, a hash map from keys to
+  values that many tasks can add to, look up and remove from at once.
+
+  A parSafe associative domain protects its whole hash table with a single
+  lock, so adding indices to it from a ``forall`` loop runs no faster than
+  a serial loop.  A :class:`ConcurrentMap` is instead split into many
+  segments, each an open addressing hash table with its own lock.  A key's
+  hash selects its segment, so tasks working on different keys rarely
+  wait for each other.  When a segment fills up, only that segment is
+  resized while the others stay available.
+
+  .. code-block:: chapel
+
+    use ConcurrentMap;
+
+    var counts = new owned ConcurrentMap(string, int);
+
+    forall word in words do
+      counts.addOrCombine(word, 1, new SumCombiner());
+
+    for (word, count) in counts do
+      writeln(word, ": ", count);
+
+  Iterating over a map, or calling :proc:`ConcurrentMap.removeAll`, must not
+  happen while other tasks are changing it.
+
+  Associative domains do not use this map yet.  A parSafe associative
+  domain still uses a single lock.  :proc:`ConcurrentMap.keysDomain`
+  copies the keys of a map into an associative domain once the updates
+  are done.  A domain implementation backed by this map is a follow-up.
+
+  .. note::
+
+      This module is expected to change in the future.
+ */
+module ConcurrentMap {
+
+  /*
+    The number of segments in a new map when none is given, per task that
+    can run at once.  More segments make it less likely that two tasks
+    need the same lock.
+   */
+  config const concurrentMapSegmentsPerTask = 8;
+
+  // The smallest number of slots in a segment
+  private param minSegmentSize = 16;
+
+  private param slotEmpty: uint(8) = 0;
+  private param slotFull: uint(8) = 1;
+  private param slotDeleted: uint(8) = 2;
+
+  pragma "no doc"
+  record ConcurrentMapSlot {
+    type keyType;
+    type valType;
+    var status: uint(8) = slotEmpty;
+    var key: keyType;
+    var val: valType;
+  }
+
+  /*
+    A combiner that adds the new value to the old one, for use with
+    :proc:`ConcurrentMap.addOrCombine`.
+   */
+  record SumCombiner {
+    pragma "no doc"
+    inline proc this(ref x, y) {
+      x += y;
+    }
+  }
+
+  /*
+    A combiner that keeps the larger of the two values.
+   */
+  record MaxCombiner {
+    pragma "no doc"
+    inline proc this(ref x, y) {
+      if y > x then x = y;
+    }
+  }
+
+  /*
+    A combiner that keeps the smaller of the two values.
+   */
+  record MinCombiner {
+    pragma "no doc"
+    inline proc this(ref x, y) {
+      if y < x then x = y;
+    }
+  }
+
+  // One independently locked part of a ConcurrentMap.  The fields may
+  // only be accessed with the lock held.
+  pragma "no doc"
+  class ConcurrentMapSegment {
+    type keyType;
+    type valType;
+
+    var lock: chpl__processorAtomicType(bool);
+    var numEntries = 0;
+    var numDeleted = 0;
+    var slotDom = {0..#minSegmentSize};
+    var slots: [slotDom] ConcurrentMapSlot(keyType, valType);
+
+    inline proc acquire() {
+      // test-and-test-and-set, so that waiting tasks only read the lock
+      while true {
+        if !lock.peek() && !lock.testAndSet(memory_order_acquire) then
+          return;
+        chpl_task_yield();
+      }
+    }
+
+    inline proc release() {
+      lock.clear(memory_order_release);
+    }
+
+    // Returns (true, slot) if key is in the segment.  Otherwise returns
+    // (false, slot) where slot is where key could be added, or -1 if
+    // there is no room.
+    proc find(key: keyType, hash: uint) {
+      const mask = (slotDom.size - 1): uint;
+      var firstOpen = -1;
+      var slot = (hash & mask): int;
+
+      for 1..slotDom.size {
+        const status = slots[slot].status;
+        if status == slotEmpty {
+          if firstOpen < 0 then firstOpen = slot;
+          return (false, firstOpen);
+        } else if status == slotDeleted {
+          if firstOpen < 0 then firstOpen = slot;
+        } else if slots[slot].key == key {
+          return (true, slot);
+        }
+        slot = ((slot + 1): uint & mask): int;
+      }
+
+      return (false, firstOpen);
+    }
+
+    // Make sure that n more entries can be added without resizing.
+    proc reserve(n: int) {
+      if (numEntries + numDeleted + n) * 2 <= slotDom.size then
+        return;
+
+      var newSize = slotDom.size;
+      while (numEntries + n) * 2 > newSize do
+        newSize *= 2;
+
+      // copy the slots over a new domain, so resizing slotDom leaves them
+      const oldDom = slotDom;
+      const oldSlots: [oldDom] ConcurrentMapSlot(keyType, valType) = slots;
+      slotDom = {0..#0};
+      slotDom = {0..#newSize};
+
+      const mask = (newSize - 1): uint;
+      for oldSlot in oldSlots {
+        if oldSlot.status == slotFull {
+          var slot = (hashKey(oldSlot.key) & mask): int;
+          while slots[slot].status != slotEmpty do
+            slot = ((slot + 1): uint & mask): int;
+          slots[slot] = oldSlot;
+        }
+      }
+      numDeleted = 0;
+    }
+
+    // Add key with the value val if it is not in the segment, and return
+    // whether it was added.  Otherwise replace the value if replace is
+    // true, or combine it with val unless combiner is a nothingCombiner.
+    proc addOrSet(key: keyType, hash: uint, val: valType,
+                  param replace: bool, combiner) {
+      var (found, slot) = find(key, hash);
+      if found {
+        if replace then
+          slots[slot].val = val;
+        else if combiner.type != nothingCombiner then
+          combiner(slots[slot].val, val);
+        return false;
+      }
+
+      if slot < 0 || (numEntries + numDeleted + 1) * 2 > slotDom.size {
+        reserve(1);
+        (found, slot) = find(key, hash);
+      }
+      if slots[slot].status == slotDeleted then
+        numDeleted -= 1;
+      slots[slot].status = slotFull;
+      slots[slot].key = key;
+      slots[slot].val = val;
+      numEntries += 1;
+      return true;
+    }
+
+    proc remove(key: keyType, hash: uint) {
+      const (found, slot) = find(key, hash);
+      if !found then
+        return false;
+
+      var empty: ConcurrentMapSlot(keyType, valType);
+      slots[slot] = empty;
+      slots[slot].status = slotDeleted;
+      numEntries -= 1;
+      numDeleted += 1;
+      return true;
+    }
+
+    proc clear() {
+      slotDom = {0..#0};
+      slotDom = {0..#minSegmentSize};
+      numEntries = 0;
+      numDeleted = 0;
+    }
+  }
+
+  // Used in place of a combiner when values are not combined
+  pragma "no doc"
+  record nothingCombiner { }
+
+  private inline proc hashKey(key): uint {
+    return chpl__defaultHash(key);
+  }
+
+  /*
+    A hash map from ``keyType`` to ``valType`` that is safe to change from
+    many tasks at once.
+   */
+  class ConcurrentMap {
+    /* The type of the keys */
+    type keyType;
+
+    /* The type of the values */
+    type valType;
+
+    pragma "no doc"
+    const numSegments: int;
+
+    pragma "no doc"
+    const segmentDom = {0..#numSegments};
+
+    pragma "no doc"
+    var segments: [segmentDom] unmanaged ConcurrentMapSegment(keyType,
+                                                               valType);
+
+    /*
+      Create an empty map.
+
+      :arg keyType: The type of the keys
+      :arg valType: The type of the values
+      :arg segments: The number of independently locked segments.  If this
+                     is not positive, a power of two at least
+                     :const:`concurrentMapSegmentsPerTask` times
+                     ``here.maxTaskPar`` is used.
+     */
+    proc init(type keyType, type valType, segments: int = 0) {
+      this.keyType = keyType;
+      this.valType = valType;
+      var n = 1;
+      const want = if segments > 0 then segments
+                   else concurrentMapSegmentsPerTask * here.maxTaskPar;
+      while n < want do
+        n *= 2;
+      this.numSegments = n;
+      this.complete();
+      for s in this.segments do
+        s = new unmanaged ConcurrentMapSegment(keyType, valType);
+    }
+
+    pragma "no doc"
+    proc deinit() {
+      for s in segments do
+        delete s;
+    }
+
+    pragma "no doc"
+    inline proc segmentFor(hash: uint) {
+      // The low bits pick the slot within a segment, so use the high bits
+      return segments[((hash >> 32) % numSegments: uint): int];
+    }
+
+    /* The number of keys in the map. */
+    proc size {
+      var n = 0;
+      for s in segments {
+        s.acquire();
+        n += s.numEntries;
+        s.release();
+      }
+      return n;
+    }
+
+    /* Returns ``true`` if the map has no keys. */
+    proc isEmpty() {
+      return size == 0;
+    }
+
+    /*
+      Add ``key`` with the value ``val`` if ``key`` is not in the map
+      already.
+
+      :returns: ``true`` if ``key`` was added
+     */
+    proc add(key: keyType, val: valType): bool {
+      const hash = hashKey(key);
+      const s = segmentFor(hash);
+      s.acquire();
+      const added = s.addOrSet(key, hash, val, replace=false,
+                               new nothingCombiner());
+      s.release();
+      return added;
+    }
+
+    /*
+      Set the value at ``key`` to ``val``, adding ``key`` if it is not in
+      the map already.
+
+      :returns: ``true`` if ``key`` was added
+     */
+    proc set(key: keyType, val: valType): bool {
+      const hash = hashKey(key);
+      const s = segmentFor(hash);
+      s.acquire();
+      const added = s.addOrSet(key, hash, val, replace=true,
+                               new nothingCombiner());
+      s.release();
+      return added;
+    }
+
+    /*
+      Add ``key`` with the value ``val`` if ``key`` is not in the map.
+      Otherwise, call ``combiner(v, val)`` with ``v`` a reference to the
+      value at ``key``, while holding the lock for ``key``.  See
+      :record:`SumCombiner` for an example of a combiner.
+
+      :returns: ``true`` if ``key`` was added
+     */
+    proc addOrCombine(key: keyType, val: valType, combiner): bool {
+      const hash = hashKey(key);
+      const s = segmentFor(hash);
+      s.acquire();
+      const added = s.addOrSet(key, hash, val, replace=false, combiner);
+      s.release();
+      return added;
+    }
+
+    /*
+      Add the keys in ``keys`` with the corresponding values in ``vals``.
+      Keys that are in the map already keep their values, as with
+      :proc:`add`.
+
+      This is faster than calling :proc:`add` for each key, because each
+      task sorts its share of the keys by segment and then takes the lock
+      of each segment once.
+     */
+    proc addAll(keys: [?D] keyType, vals: [D] valType) where D.rank == 1 {
+      addAllHelper(keys, vals, new nothingCombiner());
+    }
+
+    /*
+      As :proc:`addAll`, but keys that are in the map already have their
+      values combined with the new ones, as with :proc:`addOrCombine`.
+     */
+    proc addOrCombineAll(keys: [?D] keyType, vals: [D] valType,
+                         combiner) where D.rank == 1 {
+      addAllHelper(keys, vals, combiner);
+    }
+
+    pragma "no doc"
+    proc addAllHelper(keys: [?D], vals: [D], combiner) {
+      const n = D.size;
+      if n == 0 then
+        return;
+
+      const nTasks = max(1, min(here.maxTaskPar, n / 1024));
+      const lo = D.low;
+
+      coforall t in 0..#nTasks {
+        const myLo = lo + (n * t) / nTasks,
+              myHi = lo + (n * (t+1)) / nTasks - 1;
+        const myN = myHi - myLo + 1;
+
+        // Group this task's keys by segment with a counting sort
+        var hashes: [0..#myN] uint;
+        var counts: [0..numSegments] int;
+        for i in 0..#myN {
+          hashes[i] = hashKey(keys[myLo + i]);
+          counts[((hashes[i] >> 32) % numSegments: uint): int + 1] += 1;
+        }
+        for seg in 1..numSegments do
+          counts[seg] += counts[seg-1];
+
+        var order: [0..#myN] int;
+        var next = counts;
+        for i in 0..#myN {
+          const seg = ((hashes[i] >> 32) % numSegments: uint): int;
+          order[next[seg]] = i;
+          next[seg] += 1;
+        }
+
+        for seg in 0..#numSegments {
+          if counts[seg] == counts[seg+1] then
+            continue;
+          const s = segments[seg];
+          s.acquire();
+          s.reserve(counts[seg+1] - counts[seg]);
+          for j in counts[seg]..counts[seg+1]-1 {
+            const i = order[j];
+            s.addOrSet(keys[myLo + i], hashes[i], vals[myLo + i],
+                       replace=false, combiner);
+          }
+          s.release();
+        }
+      }
+    }
+
+    /* Returns ``true`` if ``key`` is in the map. */
+    proc contains(key: keyType): bool {
+      const hash = hashKey(key);
+      const s = segmentFor(hash);
+      s.acquire();
+      const (found, _) = s.find(key, hash);
+      s.release();
+      return found;
+    }
+
+    /*
+      Returns the value at ``key``.  It is an error if ``key`` is not in
+      the map.
+     */
+    proc this(key: keyType): valType {
+      const (found, val) = get(key);
+      if !found then
+        halt("key not found in ConcurrentMap: ", key);
+      return val;
+    }
+
+    /*
+      Returns ``(true, v)`` where ``v`` is the value at ``key``, or
+      ``(false, v)`` where ``v`` is a default value of ``valType`` if
+      ``key`` is not in the map.
+     */
+    proc get(key: keyType): (bool, valType) {
+      const hash = hashKey(key);
+      const s = segmentFor(hash);
+      var ret: (bool, valType);
+      s.acquire();
+      const (found, slot) = s.find(key, hash);
+      if found then
+        ret = (true, s.slots[slot].val);
+      s.release();
+      return ret;
+    }
+
+    /*
+      Remove ``key`` from the map.
+
+      :returns: ``true`` if ``key`` was in the map
+     */
+    proc remove(key: keyType): bool {
+      const hash = hashKey(key);
+      const s = segmentFor(hash);
+      s.acquire();
+      const removed = s.remove(key, hash);
+      s.release();
+      return removed;
+    }
+
+    /* Remove every key from the map. */
+    proc removeAll() {
+      forall s in segments {
+        s.acquire();
+        s.clear();
+        s.release();
+      }
+    }
+
+    /*
+      Returns an associative domain holding the keys of the map.
+     */
+    proc keysDomain(): domain(keyType) {
+      var D: domain(keyType);
+      D.requestCapacity(size);
+      for k in keys() do
+        D += k;
+      return D;
+    }
+
+    /*
+      Iterate over the keys and values of the map, yielding ``(key,
+      value)`` tuples in no particular order.
+     */
+    iter these() {
+      for s in segments do
+        for slot in s.slots do
+          if slot.status == slotFull then
+            yield (slot.key, slot.val);
+    }
+
+    pragma "no doc"
+    iter these(param tag: iterKind) where tag == iterKind.standalone {
+      forall s in segments do
+        for slot in s.slots do
+          if slot.status == slotFull then
+            yield (slot.key, slot.val);
+    }
+
+    /* Iterate over the keys of the map in no particular order. */
+    iter keys() {
+      for (k, _) in these() do
+        yield k;
+    }
+
+    pragma "no doc"
+    iter keys(param tag: iterKind) where tag == iterKind.standalone {
+      forall (k, _) in these() do
+        yield k;
+    }
+
+    /* Iterate over the values of the map in no particular order. */
+    iter values() {
+      for (_, v) in these() do
+        yield v;
+    }
+
+    pragma "no doc"
+    iter values(param tag: iterKind) where tag == iterKind.standalone {
+      forall (_, v) in these() do
+        yield v;
+    }
+  }
+
+} // end module ConcurrentMap
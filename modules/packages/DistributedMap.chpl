@@ -0,0 +1,617 @@
+/*
+ * Copyright 2004-2019 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+  This module provides :record:`DistMap`, a hash map whose keys are spread
+  across locales, and :record:`DistMapAggregator`, which buffers updates
+  to it so that they reach each locale in batches.
+
+  Each key is owned by the locale that a mapper picks for it, using the
+  same mappers as the :mod:`HashedDist` distribution.  Every locale keeps
+  the keys it owns in a :class:`~ConcurrentMap.ConcurrentMap`, so tasks on
+  the owning locale can update it at once.
+
+  Changing a remote key with :proc:`DistMapImpl.add` or
+  :proc:`DistMapImpl.addOrCombine` takes an on-statement per call.  When
+  many keys are changed from a ``forall`` loop, give each task a
+  :record:`DistMapAggregator` instead.  It collects the updates for each
+  locale in a buffer, and sends the buffer in one on-statement when it
+  fills up, where the owning locale applies all of the updates.  When
+  updates are combined with a combiner, repeated keys only cost one
+  hash table update each on the owning locale.
+
+  .. code-block:: chapel
+
+    use DistributedMap;
+
+    var counts = new DistMap(string, int);
+
+    forall word in words with (var agg = counts.aggregator(new SumCombiner())) do
+      agg.addOrCombine(word, 1);
+    // each task's aggregator sends what is left in its buffers as it ends
+
+    writeln(counts["the"]);
+
+  :proc:`DistMapImpl.getAll` looks up many keys at once, grouping them by
+  owning locale in the same way.
+
+  .. note::
+
+      This module is expected to change in the future.
+ */
+module DistributedMap {
+
+  use ConcurrentMap;
+  use HashedDist;
+
+  /*
+    The number of updates a :record:`DistMapAggregator` buffers for each
+    locale before sending them, and the number of keys that
+    :proc:`DistMapImpl.getAll` sends to a locale at once.
+   */
+  config const distributedMapBufferSize = 1024;
+
+  pragma "no doc"
+  class DistMapRC {
+    type keyType;
+    type valType;
+    type mapperType;
+    var _pid: int;
+
+    proc deinit() {
+      coforall loc in Locales do on loc {
+        delete chpl_getPrivatizedCopy(unmanaged DistMapImpl(keyType, valType,
+                                                            mapperType),
+                                      _pid);
+      }
+    }
+  }
+
+  /*
+    A distributed hash map from ``keyType`` to ``valType``.  It is safe to
+    change from many tasks on many locales at once.
+   */
+  record DistMap {
+    /* The type of the keys */
+    type keyType;
+
+    /* The type of the values */
+    type valType;
+
+    /* The type of the mapper that picks the locale for each key */
+    type mapperType;
+
+    /*
+      The implementation of the map is forwarded.  See :class:`DistMapImpl`
+      for documentation.
+     */
+    // This is unused, and merely for documentation purposes. See '_value'.
+    var _impl: DistMapImpl(keyType, valType, mapperType);
+
+    // Privatized id...
+    pragma "no doc"
+    var _pid: int = -1;
+
+    // Reference Counting...
+    pragma "no doc"
+    var _rc: shared DistMapRC(keyType, valType, mapperType);
+
+    /*
+      Create an empty map.
+
+      :arg keyType: The type of the keys
+      :arg valType: The type of the values
+      :arg mapper: Picks the locale for each key, as for :mod:`HashedDist`
+      :arg targetLocales: The locales to store keys on
+     */
+    proc init(type keyType, type valType, mapper:?t = new DefaultMapper(),
+              targetLocales: [] locale = Locales) {
+      this.keyType = keyType;
+      this.valType = valType;
+      this.mapperType = t;
+      this._pid = (new unmanaged DistMapImpl(keyType, valType, mapper,
+                                             targetLocales)).pid;
+      this._rc = new shared DistMapRC(keyType, valType, t, _pid = _pid);
+    }
+
+    pragma "no doc"
+    inline proc _value {
+      if _pid == -1 {
+        halt("DistMap is uninitialized...");
+      }
+      return chpl_getPrivatizedCopy(unmanaged DistMapImpl(keyType, valType,
+                                                          mapperType),
+                                    _pid);
+    }
+
+    forwarding _value;
+  }
+
+  /*
+    The implementation of :record:`DistMap`.  There is a privatized copy
+    of it on every locale, which holds the keys owned by that locale.
+   */
+  class DistMapImpl {
+    pragma "no doc"
+    type keyType;
+    pragma "no doc"
+    type valType;
+    pragma "no doc"
+    type mapperType;
+
+    pragma "no doc"
+    const mapper: mapperType;
+
+    pragma "no doc"
+    var targetLocDom: domain(1);
+
+    /* The locales that keys are stored on. */
+    var targetLocales: [targetLocDom] locale;
+
+    pragma "no doc"
+    var pid: int = -1;
+
+    // The keys owned by this locale.  This field is specific to the
+    // privatized instance.
+    pragma "no doc"
+    var map: unmanaged ConcurrentMap(keyType, valType);
+
+    pragma "no doc"
+    proc init(type keyType, type valType, mapper,
+              targetLocales: [?targetLocDom] locale) {
+      this.keyType = keyType;
+      this.valType = valType;
+      this.mapperType = mapper.type;
+      this.mapper = mapper;
+      this.targetLocDom = targetLocDom;
+      this.targetLocales = targetLocales;
+      this.complete();
+      this.pid = _newPrivatizedClass(this);
+      this.map = new unmanaged ConcurrentMap(keyType, valType);
+    }
+
+    pragma "no doc"
+    proc init(other, pid) {
+      this.keyType = other.keyType;
+      this.valType = other.valType;
+      this.mapperType = other.mapperType;
+      this.mapper = other.mapper;
+      this.targetLocDom = other.targetLocDom;
+      this.targetLocales = other.targetLocales;
+      this.pid = pid;
+      this.complete();
+      this.map = new unmanaged ConcurrentMap(keyType, valType);
+    }
+
+    pragma "no doc"
+    proc deinit() {
+      delete map;
+    }
+
+    pragma "no doc"
+    proc dsiPrivatize(pid) {
+      return new unmanaged DistMapImpl(this, pid);
+    }
+
+    pragma "no doc"
+    proc dsiGetPrivatizeData() {
+      return pid;
+    }
+
+    pragma "no doc"
+    inline proc getPrivatizedThis {
+      return chpl_getPrivatizedCopy(_to_unmanaged(this.type), pid);
+    }
+
+    /* Returns the index in :var:`targetLocales` of the locale that owns
+       ``key``. */
+    inline proc localeIndexFor(key: keyType): int {
+      return mapper(key, targetLocales);
+    }
+
+    /* Returns the locale that owns ``key``. */
+    inline proc localeFor(key: keyType): locale {
+      return targetLocales[localeIndexFor(key)];
+    }
+
+    /*
+      Returns the :class:`~ConcurrentMap.ConcurrentMap` holding the keys
+      owned by this locale.
+     */
+    inline proc localMap() {
+      return map;
+    }
+
+    /* The number of keys in the map. */
+    proc size {
+      var n = 0;
+      coforall loc in targetLocales with (+ reduce n) do on loc do
+        n += getPrivatizedThis.map.size;
+      return n;
+    }
+
+    /* Returns ``true`` if the map has no keys. */
+    proc isEmpty() {
+      return size == 0;
+    }
+
+    /*
+      Add ``key`` with the value ``val`` if ``key`` is not in the map
+      already, on the locale that owns it.
+
+      :returns: ``true`` if ``key`` was added
+     */
+    proc add(key: keyType, val: valType): bool {
+      var added: bool;
+      on localeFor(key) do
+        added = getPrivatizedThis.map.add(key, val);
+      return added;
+    }
+
+    /*
+      Set the value at ``key`` to ``val``, adding ``key`` if needed.
+
+      :returns: ``true`` if ``key`` was added
+     */
+    proc set(key: keyType, val: valType): bool {
+      var added: bool;
+      on localeFor(key) do
+        added = getPrivatizedThis.map.set(key, val);
+      return added;
+    }
+
+    /*
+      Add ``key`` with the value ``val``, or combine ``val`` with the value
+      at ``key`` as for :proc:`ConcurrentMap.ConcurrentMap.addOrCombine`.
+
+      :returns: ``true`` if ``key`` was added
+     */
+    proc addOrCombine(key: keyType, val: valType, combiner): bool {
+      var added: bool;
+      on localeFor(key) do
+        added = getPrivatizedThis.map.addOrCombine(key, val, combiner);
+      return added;
+    }
+
+    /* Returns ``true`` if ``key`` is in the map. */
+    proc contains(key: keyType): bool {
+      var found: bool;
+      on localeFor(key) do
+        found = getPrivatizedThis.map.contains(key);
+      return found;
+    }
+
+    /*
+      Returns ``(true, v)`` where ``v`` is the value at ``key``, or
+      ``(false, v)`` where ``v`` is a default value if ``key`` is not in the
+      map.
+     */
+    proc get(key: keyType): (bool, valType) {
+      var ret: (bool, valType);
+      on localeFor(key) do
+        ret = getPrivatizedThis.map.get(key);
+      return ret;
+    }
+
+    /*
+      Returns the value at ``key``.  It is an error if ``key`` is not in
+      the map.
+     */
+    proc this(key: keyType): valType {
+      const (found, val) = get(key);
+      if !found then
+        halt("key not found in DistMap: ", key);
+      return val;
+    }
+
+    /*
+      Remove ``key`` from the map.
+
+      :returns: ``true`` if ``key`` was in the map
+     */
+    proc remove(key: keyType): bool {
+      var removed: bool;
+      on localeFor(key) do
+        removed = getPrivatizedThis.map.remove(key);
+      return removed;
+    }
+
+    /* Remove every key from the map. */
+    proc removeAll() {
+      coforall loc in targetLocales do on loc do
+        getPrivatizedThis.map.removeAll();
+    }
+
+    /*
+      Returns a :record:`DistMapAggregator` that buffers updates to this
+      map.  Its updates combine values with ``combiner``, or keep existing
+      values if no combiner is given.
+     */
+    proc aggregator(combiner) {
+      return new DistMapAggregator(_to_unmanaged(this), combiner);
+    }
+
+    pragma "no doc"
+    proc aggregator() {
+      return new DistMapAggregator(_to_unmanaged(this), new nothingCombiner());
+    }
+
+    /*
+      Look up every key in ``keys``.  Returns two arrays over the domain of
+      ``keys``: whether each key was found, and its value.
+
+      Each locale that stores part of ``keys`` groups its keys by the
+      locale that owns them, and looks them up with one on-statement per
+      owning locale and batch of :const:`distributedMapBufferSize` keys.
+     */
+    proc getAll(keys: [?D] keyType) where D.rank == 1 {
+      var found: [D] bool;
+      var vals: [D] valType;
+
+      coforall loc in keys.targetLocales() do on loc {
+        // The local indices may be strided, as with Cyclic, so split
+        // them by position
+        const myInds = keys.localSubdomain().dim(1);
+        const n = myInds.size;
+        const nTasks = max(1, min(here.maxTaskPar,
+                                  n / distributedMapBufferSize));
+        coforall t in 0..#nTasks {
+          const first = (n * t) / nTasks,
+                last = (n * (t+1)) / nTasks - 1;
+          if first <= last {
+            const a = myInds.orderToIndex(first),
+                  b = myInds.orderToIndex(last);
+            getAllChunk(keys, found, vals,
+                        min(a, b)..max(a, b) by myInds.stride);
+          }
+        }
+      }
+
+      return (found, vals);
+    }
+
+    // Look up keys[r], which are all on this locale, and store the results
+    // in found[r] and vals[r].
+    pragma "no doc"
+    proc getAllChunk(const ref keys, ref found, ref vals, r: range(?)) {
+      const numLocs = targetLocDom.size;
+      const locLow = targetLocDom.low;
+      const n = r.size;
+
+      // Group the indices by owning locale with a counting sort
+      var dests: [0..#n] int;
+      var counts: [0..numLocs] int;
+      for (i, d) in zip(r, dests) {
+        d = localeIndexFor(keys[i]) - locLow;
+        counts[d + 1] += 1;
+      }
+      for l in 1..numLocs do
+        counts[l] += counts[l-1];
+      var order: [0..#n] int;
+      var next = counts;
+      for (i, d) in zip(r, dests) {
+        order[next[d]] = i;
+        next[d] += 1;
+      }
+
+      var batchKeys: [0..#distributedMapBufferSize] keyType;
+      var batchFound: [0..#distributedMapBufferSize] bool;
+      var batchVals: [0..#distributedMapBufferSize] valType;
+
+      for l in 0..#numLocs {
+        var start = counts[l];
+        while start < counts[l+1] {
+          const cnt = min(counts[l+1] - start, distributedMapBufferSize);
+          for j in 0..#cnt do
+            batchKeys[j] = keys[order[start + j]];
+
+          on targetLocales[locLow + l] {
+            const ks: [0..#cnt] keyType = batchKeys[0..#cnt];
+            var fs: [0..#cnt] bool;
+            var vs: [0..#cnt] valType;
+            const m = getPrivatizedThis.map;
+            for j in 0..#cnt do
+              (fs[j], vs[j]) = m.get(ks[j]);
+            batchFound[0..#cnt] = fs;
+            batchVals[0..#cnt] = vs;
+          }
+
+          for j in 0..#cnt {
+            found[order[start + j]] = batchFound[j];
+            vals[order[start + j]] = batchVals[j];
+          }
+          start += cnt;
+        }
+      }
+    }
+
+    // Apply a batch of updates sent by an aggregator to this locale.
+    pragma "no doc"
+    proc applyBatch(ks: [] keyType, vs: [] valType, combiner) {
+      getPrivatizedThis.map.addOrCombineAll(ks, vs, combiner);
+    }
+
+    /*
+      Iterate over the keys and values of the map, yielding ``(key,
+      value)`` tuples in no particular order.
+     */
+    iter these() {
+      for loc in targetLocales {
+        // Copy each locale's keys and values here in one go
+        var (ks, vs) = localPairs(loc);
+        for (k, v) in zip(ks, vs) do
+          yield (k, v);
+      }
+    }
+
+    pragma "no doc"
+    iter these(param tag: iterKind) where tag == iterKind.standalone {
+      coforall loc in targetLocales do on loc {
+        forall kv in getPrivatizedThis.map do
+          yield kv;
+      }
+    }
+
+    pragma "no doc"
+    proc localPairs(loc: locale) {
+      var n: int;
+      on loc do n = getPrivatizedThis.map.size;
+      var ks: [0..#n] keyType;
+      var vs: [0..#n] valType;
+      on loc {
+        var i = 0;
+        for (k, v) in getPrivatizedThis.map {
+          if i >= n then break;
+          ks[i] = k;
+          vs[i] = v;
+          i += 1;
+        }
+      }
+      return (ks, vs);
+    }
+  }
+
+  /*
+    Buffers updates to a :record:`DistMap` by the locale that owns each
+    key, and sends each buffer to its locale in one on-statement when it is
+    full.  Updates to keys owned by the current locale are applied
+    immediately.
+
+    An aggregator is meant to be used by a single task, typically as a
+    task-private variable of a ``forall`` loop.  It sends its remaining
+    updates when it is deinitialized, or when :proc:`flush` is called.
+    Until then, buffered updates are not visible in the map.
+   */
+  record DistMapAggregator {
+    pragma "no doc"
+    type keyType;
+    pragma "no doc"
+    type valType;
+    pragma "no doc"
+    type mapperType;
+    pragma "no doc"
+    type combinerType;
+
+    pragma "no doc"
+    var impl: unmanaged DistMapImpl(keyType, valType, mapperType);
+
+    pragma "no doc"
+    var combiner: combinerType;
+
+    // The buffer for the locale with index l in targetLocales starts at
+    // (l - locDom.low) * distributedMapBufferSize
+    pragma "no doc"
+    var locDom: domain(1);
+
+    pragma "no doc"
+    var bufDom: domain(1);
+
+    pragma "no doc"
+    var keyBuf: [bufDom] keyType;
+
+    pragma "no doc"
+    var valBuf: [bufDom] valType;
+
+    pragma "no doc"
+    var counts: [locDom] int;
+
+    pragma "no doc"
+    proc init(impl: unmanaged DistMapImpl(?), combiner) {
+      this.keyType = impl.keyType;
+      this.valType = impl.valType;
+      this.mapperType = impl.mapperType;
+      this.combinerType = combiner.type;
+      this.impl = impl.getPrivatizedThis;
+      this.combiner = combiner;
+      this.locDom = impl.targetLocDom;
+      this.bufDom = {0..#locDom.size * distributedMapBufferSize};
+    }
+
+    pragma "no doc"
+    proc init=(other: DistMapAggregator) {
+      // Copies start with empty buffers, so no update is sent twice
+      this.keyType = other.keyType;
+      this.valType = other.valType;
+      this.mapperType = other.mapperType;
+      this.combinerType = other.combinerType;
+      this.impl = other.impl;
+      this.combiner = other.combiner;
+      this.locDom = other.locDom;
+      this.bufDom = other.bufDom;
+    }
+
+    pragma "no doc"
+    proc deinit() {
+      flush();
+    }
+
+    /*
+      Add ``key`` with the value ``val``.  If ``key`` is in the map
+      already, its value is combined with ``val`` using the aggregator's
+      combiner, or kept if it has none.
+     */
+    proc addOrCombine(key: keyType, val: valType) {
+      const l = impl.localeIndexFor(key);
+      if impl.targetLocales[l] == here {
+        // impl is the instance of the locale that created the aggregator,
+        // so use this locale's own copy
+        impl.getPrivatizedThis.map.addOrCombine(key, val, combiner);
+        return;
+      }
+
+      const c = counts[l];
+      const i = (l - locDom.low) * distributedMapBufferSize + c;
+      keyBuf[i] = key;
+      valBuf[i] = val;
+      counts[l] = c + 1;
+      if c + 1 == distributedMapBufferSize then
+        flush(l);
+    }
+
+    /* Synonym for addOrCombine. */
+    inline proc add(key: keyType, val: valType) {
+      addOrCombine(key, val);
+    }
+
+    /* Send the buffered updates for every locale. */
+    proc flush() {
+      for l in locDom do
+        if counts[l] > 0 then
+          flush(l);
+    }
+
+    pragma "no doc"
+    proc flush(l: int) {
+      const cnt = counts[l];
+      if cnt == 0 then
+        return;
+
+      const start = (l - locDom.low) * distributedMapBufferSize;
+      const myImpl = impl, myCombiner = combiner;
+      on impl.targetLocales[l] {
+        // Bring the buffer here with bulk copies
+        const ks: [0..#cnt] keyType = keyBuf[start..#cnt];
+        const vs: [0..#cnt] valType = valBuf[start..#cnt];
+        myImpl.applyBatch(ks, vs, myCombiner);
+      }
+      counts[l] = 0;
+    }
+  }
+
+} // end module DistributedMap
@@ -427,6 +427,11 @@ the sorting algorithm.
   This function currently either uses a parallel radix sort or a serial
   quickSort. The algorithms used will change over time.
 
+  If ``Data`` is distributed across several locales, as Block and Cyclic
+  arrays are, it instead uses a distributed sample sort.  Each locale
+  sorts its own elements with one of the algorithms above, and then the
+  elements are exchanged between locales using bulk transfers.
+
   It currently uses parallel radix sort if the following conditions are met:
 
     * the array being sorted is over a non-strided domain
@@ -447,6 +452,11 @@ the sorting algorithm.
     * ``string``
     * ``c_string``
 
+  For large arrays of keys that are at most 32 bits wide, the radix sort
+  processes the least significant digit first, which needs temporary
+  space as large as ``Data``.  Otherwise it processes the most
+  significant digit first and sorts in place.
+
 :arg Data: The array to be sorted
 :type Data: [] `eltType`
 :arg comparator: :ref:`Comparator <comparators>` record that defines how the
@@ -460,7 +470,20 @@ proc sort(Data: [?Dom] ?eltType, comparator:?rec=defaultComparator) {
   if Dom.low >= Dom.high then
     return;
 
+  if distributedSortOk(Data) {
+    if Data.targetLocales().size > 1 {
+      distributedSort(Data, comparator);
+      return;
+    }
+  }
+
   if radixSortOk(Data, comparator) {
+    if msbRadixSortParamLastStartBit(Data, comparator) >= 0 {
+      if lsbRadixSortPreferred(Data, comparator) {
+        lsbRadixSort(Data, comparator=comparator);
+        return;
+      }
+    }
     msbRadixSort(Data, comparator=comparator);
   } else {
     quickSort(Data, comparator=comparator);
@@ -1040,6 +1063,11 @@ record MSBRadixSortSettings {
   param progress = false; // print progress
   const alwaysSerial = false; // never create tasks
   const maxTasks = here.numPUs(logical=true); // maximum number of tasks to make
+  const minForParallelShuffle = 1 << 16; // when sorting >= this many elements,
+                                         // move elements into bins in parallel
+  const minForLSB = 1 << 16; // use LSB radix sort for fixed-width keys
+                             // when sorting >= this many elements
+  const maxLSBBits = 32; // ... and keys have at most this many bits
 }
 
 // Get the bin for a record by calling criterion.keyPart
@@ -1192,7 +1220,8 @@ proc findDataStartBit(startbit:int, min_ubits, max_ubits):int {
 }
 
 pragma "no doc"
-proc msbRadixSort(Data:[], comparator:?rec=defaultComparator) {
+proc msbRadixSort(Data:[], comparator:?rec=defaultComparator,
+                  settings=new MSBRadixSortSettings()) {
 
   var endbit:int;
   endbit = msbRadixSortParamLastStartBit(Data, comparator);
@@ -1202,7 +1231,7 @@ proc msbRadixSort(Data:[], comparator:?rec=defaultComparator) {
   msbRadixSort(start_n=Data.domain.low, end_n=Data.domain.high,
                Data, comparator,
                startbit=0, endbit=endbit,
-               settings=new MSBRadixSortSettings());
+               settings=settings);
 }
 
 // startbit counts from 0 and is a multiple of RADIX_BITS
@@ -1294,6 +1323,17 @@ proc msbRadixSort(start_n:int, end_n:int, A:[], criterion,
   if settings.progress then writeln("shuffle");
 
   // Step 3: shuffle
+  const nShuffleTasks = min(settings.maxTasks,
+                            (end_n - start_n + 1) / settings.minForTask);
+
+  if settings.alwaysSerial == false && nShuffleTasks > 1 &&
+     end_n - start_n + 1 >= settings.minForParallelShuffle {
+    msbRadixSortParallelShuffle(A, criterion, startbit,
+                                offsets, end_offsets, nShuffleTasks,
+                                settings);
+    curbin = radix + 1;
+  }
+
   while true {
     // Find the next bin that isn't totally in place.
     while curbin <= radix && offsets[curbin] == end_offsets[curbin] {
@@ -1308,9 +1348,6 @@ proc msbRadixSort(start_n:int, end_n:int, A:[], criterion,
     // buf would need to be populated with the first M elements that aren't
     // already in the correct bin.
 
-    // TODO: I think it's possible to make this shuffle parallel
-    // by imagining each task has a max_buf and have them update
-    // atomic offsets.
     param max_buf = settings.DISTRIBUTE_BUFFER;
     var buf: max_buf*A.eltType;
     var used_buf = 0;
@@ -1421,6 +1458,192 @@ proc msbRadixSort(start_n:int, end_n:int, A:[], criterion,
   if settings.CHECK_SORTS then checkSorted(start_n, end_n, A, criterion);
 }
 
+// Move the elements of A into the bins bin_starts[i]..bin_ends[i]-1
+// using nTasks tasks, in the style of PARADIS.
+//
+// Each task is given a share of what is left of every bin.  It walks
+// through its shares, swapping each element into the task's own share of
+// the element's bin, and puts an element back where it was found when
+// that share is full.  No other task touches these elements, so no
+// synchronization is needed.  Then, in parallel for each bin, the
+// elements that could not be placed are swapped to the end of the bin,
+// and the process repeats with just those elements.
+private
+proc msbRadixSortParallelShuffle(A:[], criterion, startbit:int,
+                                 const ref bin_starts:[] int,
+                                 const ref bin_ends:[] int,
+                                 nTasks:int, settings)
+{
+  const Bins = bin_starts.domain;
+  const ends = bin_ends;
+  var heads = bin_starts;
+  var useTasks = nTasks;
+  var remaining = + reduce (ends - heads);
+
+  while remaining > 0 {
+    // Divide what is left of each bin among the tasks
+    const TaskBins = {0..#useTasks, Bins.dim(1)};
+    var taskHeads, taskEnds: [TaskBins] int;
+
+    for bin in Bins {
+      const len = ends[bin] - heads[bin];
+      for t in 0..#useTasks {
+        taskHeads[t, bin] = heads[bin] + (len * t) / useTasks;
+        taskEnds[t, bin] = heads[bin] + (len * (t+1)) / useTasks;
+      }
+    }
+
+    // Move elements between the shares of each task
+    coforall t in 0..#useTasks {
+      var myHeads: [Bins] int = taskHeads[t, ..];
+      const myEnds: [Bins] int = taskEnds[t, ..];
+      var v: A.eltType;
+
+      for bin in Bins {
+        for i in myHeads[bin]..myEnds[bin]-1 {
+          v <=> A[i];
+          var (k, _) = binForRecord(v, criterion, startbit);
+          while k != bin && myHeads[k] < myEnds[k] {
+            v <=> A[myHeads[k]];
+            myHeads[k] += 1;
+            (k, _) = binForRecord(v, criterion, startbit);
+          }
+          // v is in the right bin, or there is no room for it
+          A[i] <=> v;
+        }
+        myHeads[bin] = myEnds[bin];
+      }
+    }
+
+    // Gather the elements that are still in the wrong bin at its end
+    forall bin in Bins {
+      var lo = heads[bin];
+      var hi = ends[bin] - 1;
+      while true {
+        while lo <= hi && binForRecord(A[lo], criterion, startbit)(1) == bin do
+          lo += 1;
+        while lo <= hi && binForRecord(A[hi], criterion, startbit)(1) != bin do
+          hi -= 1;
+        if lo >= hi then
+          break;
+        A[lo] <=> A[hi];
+        lo += 1;
+        hi -= 1;
+      }
+      heads[bin] = lo;
+    }
+
+    const left = + reduce (ends - heads);
+
+    if settings.progress then writeln("parallel shuffle left ", left);
+
+    // A single task always places every element, so use one when too
+    // few elements were placed to be worth another round in parallel.
+    if left * 2 > remaining || left < settings.minForParallelShuffle then
+      useTasks = 1;
+
+    remaining = left;
+  }
+}
+
+// Returns true if lsbRadixSort should be used instead of msbRadixSort
+// for keys with a fixed width.  It makes a pass over the data for every
+// digit, so it only does better for narrow keys and large arrays.
+private
+proc lsbRadixSortPreferred(Data:[], comparator,
+                           settings=new MSBRadixSortSettings()) {
+  param lastStartBit = msbRadixSortParamLastStartBit(Data, comparator);
+  return lastStartBit + RADIX_BITS <= settings.maxLSBBits &&
+         Data.size >= settings.minForLSB;
+}
+
+// LSB (least significant digit first) radix sort for keys with a fixed
+// width.  This is stable and makes one pass over the data per digit,
+// skipping digits that are the same for every element, but it needs a
+// second array as large as A.
+pragma "no doc"
+proc lsbRadixSort(A:[], comparator:?rec=defaultComparator,
+                  settings=new MSBRadixSortSettings()) {
+  param lastStartBit = msbRadixSortParamLastStartBit(A, comparator);
+  if lastStartBit < 0 then
+    compilerError("lsbRadixSort requires keys with a fixed width");
+
+  const n = A.size;
+  const nTasks = if settings.alwaysSerial then 1
+                 else max(1, min(settings.maxTasks, n / settings.minForTask));
+  var Scratch: [A.domain] A.eltType;
+  var inScratch = false;
+
+  for startbit in 0..lastStartBit by -RADIX_BITS {
+    var moved: bool;
+    if inScratch then
+      moved = lsbRadixSortPass(Scratch, A, comparator, startbit, nTasks);
+    else
+      moved = lsbRadixSortPass(A, Scratch, comparator, startbit, nTasks);
+    if moved then
+      inScratch = !inScratch;
+  }
+
+  if inScratch then
+    A = Scratch;
+
+  if settings.CHECK_SORTS then
+    checkSorted(A.domain.low, A.domain.high, A, comparator);
+}
+
+// Stably move the elements of Src into Dst ordered by the digit at
+// startbit.  Each task counts and then moves a contiguous chunk of Src.
+// Returns false, without moving anything, if every element has the same
+// digit.
+private
+proc lsbRadixSortPass(const ref Src:[?Dom], ref Dst:[], criterion,
+                      startbit:int, nTasks:int): bool
+{
+  const radix = (1 << RADIX_BITS) + 1;
+  const Bins = {0..radix};
+  const n = Dom.size;
+  var offsets: [0..#nTasks, 0..radix] int;
+
+  proc chunk(t) {
+    return (Dom.low + (n * t) / nTasks)..(Dom.low + (n * (t+1)) / nTasks - 1);
+  }
+
+  // Step 1: count
+  coforall t in 0..#nTasks {
+    var myCounts: [Bins] int;
+    for i in chunk(t) do
+      myCounts[binForRecord(Src[i], criterion, startbit)(1)] += 1;
+    offsets[t, ..] = myCounts;
+  }
+
+  for bin in Bins {
+    if + reduce offsets[.., bin] == n then
+      return false;
+  }
+
+  // Step 2: accumulate, ordering by bin and then by task
+  var sum = Dom.low;
+  for bin in Bins {
+    for t in 0..#nTasks {
+      const count = offsets[t, bin];
+      offsets[t, bin] = sum;
+      sum += count;
+    }
+  }
+
+  // Step 3: move
+  coforall t in 0..#nTasks {
+    var myOffsets: [Bins] int = offsets[t, ..];
+    for i in chunk(t) {
+      const (bin, _) = binForRecord(Src[i], criterion, startbit);
+      Dst[myOffsets[bin]] = Src[i];
+      myOffsets[bin] += 1;
+    }
+  }
+
+  return true;
+}
+
 // Check that the elements from start_n..end_n in A are sorted by criterion
 private
 proc checkSorted(start_n:int, end_n:int, A:[], criterion, startbit = 0)
@@ -1437,6 +1660,248 @@ proc checkSorted(start_n:int, end_n:int, A:[], criterion, startbit = 0)
   }
 }
 
+/* Distributed sort */
+
+// When choosing the splitters for a distributed sort, each locale
+// contributes this many samples per target locale.
+private param DIST_SORT_OVERSAMPLE = 16;
+
+// The elements held by one locale during a distributed sort
+pragma "no doc"
+class DistSortChunk {
+  type eltType;
+  var D: domain(1);
+  var A: [D] eltType;
+}
+
+// Can Data be sorted with distributedSort?  It must be distributed so
+// that each locale stores a single subdomain, as Block and Cyclic do.
+private
+proc distributedSortOk(Data: [?Dom]) param {
+  use Reflection;
+
+  if chpl__isDROrDRView(Data) || chpl__isArrayView(Data) || Dom.stridable then
+    return false;
+  else if canResolveMethod(Data._value, "dsiHasSingleLocalSubdomain") then
+    return Data.hasSingleLocalSubdomain();
+  else
+    return false;
+}
+
+// Samples and splitters are (element, run, position in run) tuples.
+// Ordering equal elements by where they are stored gives every element a
+// distinct place in the order, so that runs of equal keys can be split
+// across several buckets.
+pragma "no doc"
+record DistSortSampleComparator {
+  var comparator;
+
+  proc compare(a, b) {
+    const c = chpl_compare(a(1), b(1), comparator);
+    if c != 0 then
+      return c;
+    else if a(2) != b(2) then
+      return if a(2) < b(2) then -1 else 1;
+    else if a(3) != b(3) then
+      return if a(3) < b(3) then -1 else 1;
+    else
+      return 0;
+  }
+}
+
+// Returns the first index in start..A.domain.high of run i whose element
+// sorts after the splitter s, or A.domain.high+1 if there is none.
+private
+proc distSortSplitPoint(A: [?Dom], in start: int, i: int, s, comparator) {
+  var end = Dom.high + 1;
+
+  while start < end {
+    const mid = start + (end - start) / 2;
+    var c = chpl_compare(A[mid], s(1), comparator);
+    if c == 0 then
+      c = if i != s(2) then i - s(2) else mid - s(3);
+    if c > 0 then
+      end = mid;
+    else
+      start = mid + 1;
+  }
+
+  return start;
+}
+
+// Sample sort for a 1-D array distributed across several locales.
+//
+// 1. Each locale copies its elements into a run and sorts it.
+// 2. Regularly spaced samples of the runs are gathered and sorted, and
+//    numLocales-1 of them are chosen as splitters.  Equal elements are
+//    ordered by their run and position, so that many equal keys are
+//    still spread over all of the buckets.
+// 3. Each locale splits its run into one bucket per locale at the
+//    splitters, and the bucket sizes are gathered.
+// 4. Each locale gathers its bucket from all of the runs with bulk
+//    copies and sorts it.  If each locale's part of Data is dense, as
+//    with Block, the bucket is copied into its place in Data.
+// 5. Otherwise, as with Cyclic, a bucket's place in Data is spread over
+//    every locale.  Each locale copies the parts of the buckets that fall
+//    on its own indices of Data with strided reads, so that all of the
+//    writes are local.
+//
+// This uses temporary space for about twice the number of elements.
+private
+proc distributedSort(Data: [?Dom] ?eltType, comparator) {
+  param stridedLocalParts = Data.localSubdomain().stridable;
+  const targetLocs = Data.targetLocales();
+  const numLocs = targetLocs.size;
+  const LocIds = {0..#numLocs};
+  const LocPairs = {0..#numLocs, 0..#numLocs};
+  var locs: [LocIds] locale;
+
+  for (l, t) in zip(locs, targetLocs) do
+    l = t;
+
+  var runs: [LocIds] unmanaged DistSortChunk(eltType);
+  var numSamples: [LocIds] int;
+
+  // Step 1: sort the elements on each locale
+  coforall (loc, i) in zip(locs, LocIds) do on loc {
+    const mySub = Data.localSubdomain();
+    const run = new unmanaged DistSortChunk(eltType, {0..#mySub.size});
+
+    if mySub.size > 0 {
+      run.A = Data[mySub];
+      sort(run.A, comparator);
+    }
+
+    runs[i] = run;
+    numSamples[i] = min(mySub.size, DIST_SORT_OVERSAMPLE * numLocs);
+  }
+
+  // Step 2: choose the splitters
+  type sampleType = (eltType, int, int);
+  const totalSamples = + reduce numSamples;
+  const sampleStarts = (+ scan numSamples) - numSamples;
+  var samples: [0..#totalSamples] sampleType;
+
+  coforall (loc, i) in zip(locs, LocIds) do on loc {
+    const run = runs[i];
+    const n = run.A.size;
+    const m = numSamples[i];
+    var mySamples: [0..#m] sampleType;
+
+    for j in 0..#m {
+      const pos = (j * n) / m;
+      mySamples[j] = (run.A[pos], i, pos);
+    }
+
+    if m > 0 then
+      samples[sampleStarts[i]..#m] = mySamples;
+  }
+
+  sort(samples, new DistSortSampleComparator(comparator));
+
+  var splitters: [0..#(numLocs-1)] sampleType;
+
+  for j in 0..#(numLocs-1) do
+    splitters[j] = samples[((j+1) * totalSamples) / numLocs];
+
+  // Step 3: split each run into buckets.
+  // counts[i, j] is the number of elements in run i for bucket j.
+  var counts: [LocPairs] int;
+
+  coforall (loc, i) in zip(locs, LocIds) do on loc {
+    const run = runs[i];
+    const mySplitters = splitters;
+    var myCounts: [LocIds] int;
+    var start = 0;
+
+    for j in LocIds {
+      const end = if j == numLocs-1 then run.A.size
+                  else distSortSplitPoint(run.A, start, i, mySplitters[j],
+                                          comparator);
+      myCounts[j] = end - start;
+      start = end;
+    }
+
+    counts[i, ..] = myCounts;
+  }
+
+  // runStarts[i, j] is where bucket j starts in run i, and
+  // bucketStarts[j] is where bucket j starts in Data.
+  var runStarts: [LocPairs] int;
+  var bucketStarts: [LocIds] int;
+  var total = 0;
+
+  for i in LocIds {
+    var start = 0;
+    for j in LocIds {
+      runStarts[i, j] = start;
+      start += counts[i, j];
+    }
+  }
+
+  for j in LocIds {
+    bucketStarts[j] = total;
+    for i in LocIds do
+      total += counts[i, j];
+  }
+
+  // Step 4: gather and sort each bucket
+  var buckets: [LocIds] unmanaged DistSortChunk(eltType);
+
+  coforall (loc, j) in zip(locs, LocIds) do on loc {
+    const myCounts: [LocIds] int = counts[.., j];
+    const myRunStarts: [LocIds] int = runStarts[.., j];
+    const myOffsets = (+ scan myCounts) - myCounts;
+    const size = + reduce myCounts;
+    const bucket = new unmanaged DistSortChunk(eltType, {0..#size});
+
+    forall i in LocIds {
+      const count = myCounts[i];
+      if count > 0 then
+        bucket.A[myOffsets[i]..#count] = runs[i].A[myRunStarts[i]..#count];
+    }
+
+    if size > 0 {
+      sort(bucket.A, comparator);
+      if !stridedLocalParts then
+        Data[(Dom.low + bucketStarts[j])..#size] = bucket.A;
+    }
+
+    buckets[j] = bucket;
+  }
+
+  coforall (loc, i) in zip(locs, LocIds) do on loc {
+    delete runs[i];
+  }
+
+  // Step 5: copy the buckets into place
+  if stridedLocalParts {
+    coforall (loc, i) in zip(locs, LocIds) do on loc {
+      const myInds = Data.localSubdomain().dim(1);
+      const myStarts = bucketStarts;
+
+      for j in LocIds {
+        const bucket = buckets[j];
+        const bucketLow = Dom.low + myStarts[j];
+        const inds = myInds[bucketLow..#bucket.A.size];
+
+        if inds.size == 0 then
+          continue;
+
+        const first = inds.first - bucketLow;
+        const part: [0..#inds.size] eltType =
+          bucket.A[first.. by inds.stride #inds.size];
+        forall (idx, x) in zip(inds, part) do
+          Data[idx] = x;
+      }
+    }
+  }
+
+  coforall (loc, j) in zip(locs, LocIds) do on loc {
+    delete buckets[j];
+  }
+}
+
 /* Comparators */
 
 /* Default comparator used in sort functions.*/
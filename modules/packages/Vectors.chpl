@@ -0,0 +1,356 @@
+/*
+ * Copyright 2004-2019 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+  This module provides :record:`vector`, a growable list that stores its
+  elements contiguously.
+
+  Unlike :record:`~LinkedLists.LinkedList`, appending an element does not
+  allocate memory except when the vector runs out of capacity, at which
+  point the capacity is doubled.  Elements can be accessed by index in
+  constant time, and iterating over a vector walks over contiguous memory,
+  either serially or in parallel.
+
+  .. code-block:: chapel
+
+    use Vectors;
+
+    var v: vector(int);
+    for i in 1..5 do
+      v.append(i);
+    v.append([6, 7, 8]);
+
+    forall x in v do
+      x *= 2;
+
+    writeln(v);     // prints 2 4 6 8 10 12 14 16
+    writeln(v[0]);  // prints 2
+
+  Vectors are values: assigning or copying a vector copies its elements.
+
+  .. note::
+
+      This module is expected to change in the future.
+ */
+module Vectors {
+
+  use HaltWrappers;
+
+  /* The capacity a vector starts with when the first element is added. */
+  config const vectorMinCapacity = 16;
+
+  /*
+    A growable list of elements stored contiguously and indexed from 0.
+
+    If ``parSafe`` is ``true``, methods that change the vector use a
+    lock, so that several tasks can append to or pop from the same vector
+    at once.  Indexing and iterating over a vector are never protected by
+    the lock, and must not be done while another task is changing it.
+    Tasks need a ``ref`` intent to change a vector declared outside them:
+
+    .. code-block:: chapel
+
+      var v = new vector(int, parSafe=true);
+      forall i in 1..100 with (ref v) do
+        v.append(i);
+   */
+  record vector {
+    /* The type of the elements stored in the vector. */
+    type eltType;
+
+    /* If ``true``, changing the vector is safe with several tasks. */
+    param parSafe = false;
+
+    pragma "no doc"
+    var _dom = {0..#0};
+
+    pragma "no doc"
+    var _data: [_dom] eltType;
+
+    pragma "no doc"
+    var _size = 0;
+
+    pragma "no doc"
+    var _lock: chpl__processorAtomicType(bool); // do not access directly
+
+    /*
+      Create an empty vector.
+
+      :arg eltType: The type of the elements
+      :arg parSafe: If ``true``, the vector can be changed by several tasks
+      :arg capacity: Reserve space for this many elements
+     */
+    proc init(type eltType, param parSafe = false, capacity: int = 0) {
+      this.eltType = eltType;
+      this.parSafe = parSafe;
+      this._dom = {0..#max(capacity, 0)};
+    }
+
+    pragma "no doc"
+    proc init=(other: vector(?t, ?p)) {
+      this.eltType = t;
+      this.parSafe = p;
+      this._dom = {0..#other._size};
+      this.complete();
+      _data = other._data[0..#other._size];
+      _size = other._size;
+    }
+
+    pragma "no doc"
+    inline proc _enter() {
+      if parSafe then
+        while _lock.testAndSet(memory_order_acquire) do chpl_task_yield();
+    }
+
+    pragma "no doc"
+    inline proc _leave() {
+      if parSafe then
+        _lock.clear(memory_order_release);
+    }
+
+    // Grow the capacity so that at least n elements fit.
+    // The lock must be held.
+    pragma "no doc"
+    proc ref _grow(n: int) {
+      const cap = _dom.size;
+      if n <= cap then
+        return;
+      var newCap = max(cap, vectorMinCapacity);
+      while newCap < n do
+        newCap *= 2;
+      _dom = {0..#newCap};
+    }
+
+    /* The number of elements in the vector. */
+    inline proc size {
+      return _size;
+    }
+
+    /* Synonym for size. */
+    inline proc length {
+      return _size;
+    }
+
+    /* The number of elements the vector can hold before it grows. */
+    inline proc capacity {
+      return _dom.size;
+    }
+
+    /* Returns ``true`` if the vector has no elements. */
+    inline proc isEmpty() {
+      return _size == 0;
+    }
+
+    /* The indices of the elements, ``0..#size``. */
+    inline proc indices {
+      return 0..#_size;
+    }
+
+    /*
+      Make room for at least ``n`` elements without growing again.
+     */
+    proc ref reserve(n: int) {
+      _enter();
+      _grow(n);
+      _leave();
+    }
+
+    /*
+      Add ``x`` to the end of the vector.
+     */
+    proc ref append(x: eltType) {
+      _enter();
+      if _size == _dom.size then
+        _grow(_size + 1);
+      _data[_size] = x;
+      _size += 1;
+      _leave();
+    }
+
+    /*
+      Add the elements of the 1-D array ``A`` to the end of the vector,
+      in order.
+     */
+    proc ref append(A: [?D] eltType) where D.rank == 1 {
+      _enter();
+      const n = D.size;
+      _grow(_size + n);
+      _data[_size..#n] = A;
+      _size += n;
+      _leave();
+    }
+
+    /*
+      Add the elements of the vector ``other`` to the end of this one,
+      in order.
+     */
+    proc ref append(const ref other: vector(eltType, ?)) {
+      if other._size == 0 then
+        return;
+      append(other._data[0..#other._size]);
+    }
+
+    /* Synonym for append. */
+    inline proc ref push_back(x: eltType) {
+      append(x);
+    }
+
+    /*
+      Remove the last element of the vector and return it.
+      It is an error to call this on an empty vector.
+     */
+    proc ref pop(): eltType {
+      _enter();
+      if boundsChecking && _size == 0 {
+        _leave();
+        boundsCheckHalt("pop on empty vector");
+      }
+      _size -= 1;
+      var ret = _data[_size];
+      var empty: eltType;
+      _data[_size] = empty;
+      _leave();
+      return ret;
+    }
+
+    /*
+      Remove every element from the vector.  The capacity is not changed.
+     */
+    proc ref clear() {
+      _enter();
+      var empty: eltType;
+      _data[0..#_size] = empty;
+      _size = 0;
+      _leave();
+    }
+
+    /*
+      Reduce the capacity of the vector to its size.
+     */
+    proc ref shrinkToFit() {
+      _enter();
+      _dom = {0..#_size};
+      _leave();
+    }
+
+    pragma "no doc"
+    inline proc _checkIndex(i: int) {
+      if boundsChecking && (i < 0 || i >= _size) then
+        boundsCheckHalt("vector index " + i:string + " out of bounds " +
+                        "0.." + (_size-1):string);
+    }
+
+    /*
+      Access the element at index ``i``.
+     */
+    proc ref this(i: int) ref {
+      _checkIndex(i);
+      return _data[i];
+    }
+
+    pragma "no doc"
+    proc const this(i: int) const ref {
+      _checkIndex(i);
+      return _data[i];
+    }
+
+    /* The first element of the vector. */
+    proc ref first() ref {
+      return this(0);
+    }
+
+    /* The last element of the vector. */
+    proc ref last() ref {
+      return this(_size-1);
+    }
+
+    /* Returns a new array holding the elements of the vector. */
+    proc toArray(): [0..#_size] eltType {
+      return _data[0..#_size];
+    }
+
+    /*
+      Iterate over the elements of the vector in order.
+
+      :ytype: eltType
+     */
+    iter these() ref {
+      for i in 0..#_size do
+        yield _data[i];
+    }
+
+    pragma "no doc"
+    iter these(param tag: iterKind) ref where tag == iterKind.standalone {
+      forall i in 0..#_size do
+        yield _data[i];
+    }
+
+    pragma "no doc"
+    iter these(param tag: iterKind) where tag == iterKind.leader {
+      for followThis in (0..#_size).these(tag) do
+        yield followThis;
+    }
+
+    pragma "no doc"
+    iter these(param tag: iterKind, followThis) ref
+      where tag == iterKind.follower {
+      for i in (0..#_size).these(tag, followThis) do
+        yield _data[i];
+    }
+
+    pragma "no doc"
+    proc writeThis(f) {
+      var binary = f.binary();
+      var arrayStyle = f.styleElement(QIO_STYLE_ELEMENT_ARRAY);
+      var isspace = arrayStyle == QIO_ARRAY_FORMAT_SPACE && !binary;
+      var isjson = arrayStyle == QIO_ARRAY_FORMAT_JSON && !binary;
+      var ischpl = arrayStyle == QIO_ARRAY_FORMAT_CHPL && !binary;
+
+      if binary {
+        // Write the number of elements.
+        f <~> _size;
+      }
+      if isjson || ischpl {
+        f <~> new ioLiteral("[");
+      }
+
+      for i in 0..#_size {
+        if i > 0 {
+          if isspace then f <~> new ioLiteral(" ");
+          else if isjson || ischpl then f <~> new ioLiteral(", ");
+        }
+        f <~> _data[i];
+      }
+
+      if isjson || ischpl {
+        f <~> new ioLiteral("]");
+      }
+    }
+  }
+
+  pragma "no doc"
+  proc =(ref lhs: vector(?t, ?), const ref rhs: vector(t, ?)) {
+    lhs._enter();
+    lhs._dom = {0..#rhs._size};
+    lhs._data = rhs._data[0..#rhs._size];
+    lhs._size = rhs._size;
+    lhs._leave();
+  }
+
+} // end module Vectors
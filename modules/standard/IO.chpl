@@ -6459,6 +6459,7 @@ private inline proc chpl_do_format(fmt:string, args ...?k): string throws {
 use Regexp;
 
 private extern proc qio_regexp_channel_match(const ref re:qio_regexp_t, threadsafe:c_int, ch:qio_channel_ptr_t, maxlen:int(64), anchor:c_int, can_discard:bool, keep_unmatched:bool, keep_whole_pattern:bool, submatch:_ddata(qio_regexp_string_piece_t), nsubmatch:int(64)):syserr;
+private extern proc qio_regexp_set_channel_match_line(const ref re:qio_regexp_set_t, threadsafe:c_int, ch:qio_channel_ptr_t, ref line:qio_regexp_string_piece_t, matched:c_ptr(int), nmatched:int(64), ref nfound:int(64)):syserr;
 
 pragma "no doc"
 proc channel._extractMatch(m:reMatch, ref arg:reMatch, ref error:syserr) {
@@ -6798,6 +6799,71 @@ proc channel.match(re:regexp, ref captures ...?k):reMatch throws
   return ret;
 }
 
+/*  Read the next line from the channel and search it for all of the
+    patterns in a :record:`Regexp.regexpSet` at once. The line is matched
+    directly in the channel's buffer whenever it fits there, so no string
+    is created for it. The indices of the matching patterns are stored in
+    ``found`` as :proc:`Regexp.regexpSet.search` does, so ``found`` can be
+    reused for every line of a file.
+
+    The line ends at a ``\n`` (which is consumed but not searched) or at
+    the end of the channel. The set must be on the same locale as the
+    channel.
+
+    :arg re: the compiled set of regular expressions to search for
+    :arg found: where to store the indices of the matching patterns
+    :arg nfound: the number of patterns that matched the line. This can be
+                 more than ``found.size``.
+    :returns: `true` if a line was read, `false` upon EOF
+
+    :throws SystemError: Thrown if the line could not be read from the channel.
+ */
+proc channel.searchLine(re:regexpSet, ref found:[?FD] int, out nfound:int):bool throws
+  where isRectangularDom(FD) && FD.rank == 1 && !FD.stridable
+{
+  if writing then compilerError("read on write-only channel");
+
+  const n = found.size;
+  var err:syserr = ENOERR;
+  var nf:int;
+  var line:qio_regexp_string_piece_t;
+  if this.home == here && re.home == here {
+    // Match straight into found.
+    try this.lock(); defer { this.unlock(); }
+    const ptr = if n > 0 then c_ptrTo(found[FD.low]) else nil:c_ptr(int);
+    err = qio_regexp_set_channel_match_line(re._set, false,
+                                            _channel_internal, line,
+                                            ptr, n, nf);
+  } else {
+    var got:[0..#n] int;
+    on this.home {
+      if re.home != here {
+        err = EINVAL;
+      } else {
+        try this.lock(); defer { this.unlock(); }
+        var tmp:[0..#n] int;
+        const ptr = if n > 0 then c_ptrTo(tmp[0]) else nil:c_ptr(int);
+        err = qio_regexp_set_channel_match_line(re._set, false,
+                                                _channel_internal, line,
+                                                ptr, n, nf);
+        got = tmp;
+      }
+    }
+    if !err then found = got;
+  }
+
+  if !err {
+    nfound = nf;
+    for i in FD.low..#min(n, nf) do found[i] += re._low;
+    return true;
+  } else if err == EEOF {
+    return false;
+  } else {
+    try this._ch_ioerror(err, "in channel.searchLine");
+  }
+  return false;
+}
+
 
 
 /* Enumerates matches in the string as well as capture groups.
@@ -51,6 +51,7 @@
 
      * :mod:`PCGRandom`
      * :mod:`NPBRandom`
+     * :mod:`PhiloxRandom`
 
    .. note::
 
@@ -75,15 +76,17 @@ module Random {
   use RandomSupport;
   use NPBRandom;
   use PCGRandom;
+  use PhiloxRandom;
 
 
   /* Select between different supported RNG algorithms.
-     See :mod:`PCGRandom` and :mod:`NPBRandom` for details on
-     these algorithms.
+     See :mod:`PCGRandom`, :mod:`NPBRandom` and :mod:`PhiloxRandom` for
+     details on these algorithms.
    */
   enum RNG {
     PCG = 1,
-    NPB = 2
+    NPB = 2,
+    Philox = 3
   }
 
   /* The default RNG. The current default is PCG - see :mod:`PCGRandom`. */
@@ -146,6 +149,10 @@ module Random {
 
   /* Shuffle the elements of an array into a random order.
 
+     Arrays with at least 65536 elements are shuffled in parallel, and
+     distributed arrays are shuffled on the locales that own them. The
+     result only depends on the seed, not on the number of tasks or locales.
+
      :arg arr: a 1-D non-strided array
      :arg seed: the seed to use when shuffling. Defaults to
       `oddCurrentTime` from :type:`RandomSupport.SeedGenerator`.
@@ -206,10 +213,147 @@ module Random {
       return new owned RandomStream(seed=seed, parSafe=parSafe, eltType=eltType);
     else if algorithm == RNG.NPB then
       return new owned NPBRandomStream(seed=seed, parSafe=parSafe, eltType=eltType);
+    else if algorithm == RNG.Philox then
+      return new owned PhiloxRandomStream(seed=seed, parSafe=parSafe, eltType=eltType);
     else
       compilerError("Unknown random number generator");
   }
 
+  // Arrays with fewer elements than this are shuffled by a serial
+  // Fisher-Yates loop over the stream itself.
+  pragma "no doc"
+  param _parallelShuffleMinSize = 1 << 16;
+
+  pragma "no doc"
+  /* Shuffle a 1-D array in parallel.
+
+     Every element is sent to a random bucket, the buckets are laid out one
+     after another, and then each bucket is shuffled on its own. This gives
+     a uniform random permutation (P. Sanders, "Random Permutations on
+     Distributed, External and Hierarchical Memory", IPL 1998).
+
+     Chunks of the array are bucketed on the locale that owns them, and each
+     bucket is shuffled in a local buffer on the locale that owns its part of
+     the result, so a distributed array is only moved by bulk slice
+     assignments. All random draws come from a Philox stream keyed by ``key``
+     and the number of chunks and buckets depends only on the array size, so
+     the result does not depend on the number of tasks or locales.
+
+     This needs temporary space for about two more copies of the array.
+   */
+  proc _parallelShuffle(arr: [?D], key: int(64)) {
+    use PhiloxRandom;
+
+    type idxType = D.idxType;
+    const n = D.size: int,
+          low = D.low,
+          stride = abs(D.stride): idxType;
+
+    // Chunk c's part of bucket b is moved as one slice, so keep those
+    // parts at about 4096 elements.
+    const nBuckets = min(max(1, sqrt(n / 4096.0): int), 1024),
+          nChunks = nBuckets,
+          chunkSize = divceil(n, nChunks);
+
+    // the index at a 0-based position, and the indices of a run of positions
+    inline proc idx(pos: int) {
+      return low + pos: idxType * stride;
+    }
+    inline proc indices(pos: int, count: int) {
+      if D.stridable then
+        return idx(pos)..idx(pos + count - 1) by stride;
+      else
+        return idx(pos)..idx(pos + count - 1);
+    }
+    inline proc chunk(c: int) {
+      return c * chunkSize..min(n, (c + 1) * chunkSize) - 1;
+    }
+    // draws 1..n pick the buckets, draws n+1..2n shuffle them
+    inline proc bucketOf(pos: int) {
+      return philoxBoundedUint(key, pos + 1, (nBuckets - 1): uint): int;
+    }
+
+    // Sort each chunk by bucket in place, keeping the original order
+    // within each bucket.
+    var counts: [0..#nChunks, 0..#nBuckets] int;
+    coforall c in 0..#nChunks with (ref arr, ref counts) do
+      on arr[idx(chunk(c).low)] {
+      const myChunk = chunk(c);
+      var buckets: [myChunk] int;
+      var myCounts: [0..#nBuckets] int;
+      for pos in myChunk {
+        buckets[pos] = bucketOf(pos);
+        myCounts[buckets[pos]] += 1;
+      }
+      counts[c, ..] = myCounts;
+
+      var next: [0..#nBuckets] int;
+      for b in 1..#(nBuckets - 1) do
+        next[b] = next[b-1] + myCounts[b-1];
+      const mine: [myChunk] arr.eltType =
+        arr[indices(myChunk.low, myChunk.size)];
+      var sorted: [0..#myChunk.size] arr.eltType;
+      for pos in myChunk {
+        sorted[next[buckets[pos]]] = mine[pos];
+        next[buckets[pos]] += 1;
+      }
+      arr[indices(myChunk.low, myChunk.size)] = sorted;
+    }
+
+    // Chunk c's part of bucket b goes to offsets[c, b]; within a bucket
+    // the chunks are in order.
+    var offsets: [0..#nChunks, 0..#nBuckets] int;
+    var bucketStart: [0..nBuckets] int;
+    var pos = 0;
+    for b in 0..#nBuckets {
+      bucketStart[b] = pos;
+      for c in 0..#nChunks {
+        offsets[c, b] = pos;
+        pos += counts[c, b];
+      }
+    }
+    bucketStart[nBuckets] = n;
+
+    var tmp: [D] arr.eltType;
+    coforall c in 0..#nChunks with (ref tmp) do on arr[idx(chunk(c).low)] {
+      const myChunk = chunk(c),
+            myCounts = counts[c, ..],
+            myOffsets = offsets[c, ..];
+      const sorted: [0..#myChunk.size] arr.eltType =
+        arr[indices(myChunk.low, myChunk.size)];
+      var start = 0;
+      for b in 0..#nBuckets {
+        if myCounts[b] > 0 then
+          tmp[indices(myOffsets[b], myCounts[b])] =
+            sorted[start..#myCounts[b]];
+        start += myCounts[b];
+      }
+    }
+
+    coforall b in 0..#nBuckets with (ref arr) do
+      on tmp[idx(min(bucketStart[b], n - 1))] {
+      const start = bucketStart[b],
+            size = bucketStart[b+1] - start;
+      if size > 0 {
+        var bucket: [0..#size] arr.eltType = tmp[indices(start, size)];
+        // Fisher-Yates shuffle
+        for i in 1..size-1 by -1 {
+          const k = philoxBoundedUint(key, n + start + i + 1, i: uint): int;
+          bucket[i] <=> bucket[k];
+        }
+        arr[indices(start, size)] = bucket;
+      }
+    }
+  }
+
+  pragma "no doc"
+  /* Fill a 1-D array with its indices and shuffle it in parallel. */
+  proc _parallelPermutation(arr: [], key: int(64)) {
+    forall (x, i) in zip(arr, arr.domain) do
+      x = i;
+    _parallelShuffle(arr, key);
+  }
+
   pragma "no doc"
   /* Actual implementation of choice() */
   proc _choice(stream, arr: [], size:?sizeType, replace, prob:?probType)
@@ -819,6 +963,17 @@ module Random {
         PCGRandomStreamPrivate_rngs = randlc_skipto(eltType, seed, n);
       }
 
+      // Returns a 64-bit key for _parallelShuffle() built from the next
+      // two values, and moves past the next n values in total.
+      pragma "no doc"
+      proc PCGRandomStreamPrivate_getKey_noLock(n: integral): int(64) {
+        const start = PCGRandomStreamPrivate_count;
+        const hi = PCGRandomStreamPrivate_getNext_noLock(uint(32)),
+              lo = PCGRandomStreamPrivate_getNext_noLock(uint(32));
+        PCGRandomStreamPrivate_skipToNth_noLock(start + n);
+        return ((hi:uint(64) << 32) | lo):int(64);
+      }
+
       /*
         Returns the next value in the random stream.
 
@@ -977,7 +1132,12 @@ module Random {
         return _choice(this, arr, size=size, replace=replace, prob=prob);
       }
 
-      /* Randomly shuffle a 1-D array. */
+      /* Randomly shuffle a 1-D array.
+
+         Arrays with at least 65536 elements are shuffled in parallel,
+         using this stream only to seed the shuffle. The result still only
+         depends on the stream's seed and position.
+       */
       proc shuffle(arr: [?D] ?eltType ) {
 
         if D.rank != 1 then
@@ -990,6 +1150,16 @@ module Random {
         if parSafe then
           PCGRandomStreamPrivate_lock$ = true;
 
+        if D.size >= _parallelShuffleMinSize {
+          const key = PCGRandomStreamPrivate_getKey_noLock(D.size);
+
+          if parSafe then
+            PCGRandomStreamPrivate_lock$;
+
+          _parallelShuffle(arr, key);
+          return;
+        }
+
         // Fisher-Yates shuffle
         for i in 0..#D.size by -1 {
           var k = randlc_bounded(D.idxType,
@@ -1024,6 +1194,7 @@ module Random {
       /* Produce a random permutation, storing it in a 1-D array.
          The resulting array will include each value from low..high
          exactly once, where low and high refer to the array's domain.
+         As with :proc:`shuffle`, large arrays are permuted in parallel.
          */
       proc permutation(arr: [] eltType) {
         var low = arr.domain.dim(1).low;
@@ -1037,6 +1208,16 @@ module Random {
         if parSafe then
           PCGRandomStreamPrivate_lock$ = true;
 
+        if arr.size >= _parallelShuffleMinSize {
+          const key = PCGRandomStreamPrivate_getKey_noLock(arr.size);
+
+          if parSafe then
+            PCGRandomStreamPrivate_lock$;
+
+          _parallelPermutation(arr, key);
+          return;
+        }
+
         for i in low..high {
           var j = randlc_bounded(arr.domain.idxType,
                                  PCGRandomStreamPrivate_rngs,
@@ -2669,6 +2850,565 @@ module Random {
 
   } // close module NPBRandom
 
+  /*
+     Counter-based Random Number Generator
+
+     This module provides a stream built on the Philox4x32-10 counter-based
+     RNG from the paper `Parallel Random Numbers: As Easy as 1, 2, 3` by
+     J.K. Salmon, M.A. Moraes, R.O. Dror and D.E. Shaw (SC11).
+
+     Philox computes the `n`-th value of a stream directly from the seed and
+     `n`, by applying a keyed bijection to the counter `n`. There is no state
+     to advance, so values can be computed in any order, on any task and on
+     any locale. :class:`PhiloxRandomStream` uses this to:
+
+       * get the next value with a single atomic increment instead of a lock
+       * skip to any position in constant time
+       * fill arrays (including distributed ones, such as Block arrays) in
+         parallel, with each locale computing its own elements locally
+
+     The values produced for a given seed do not depend on the number of
+     tasks or locales used.
+
+     .. note::
+
+       The interface provided by this module is expected to change.
+
+  */
+  module PhiloxRandom {
+
+    use RandomSupport;
+
+    /*
+      Models a stream of pseudorandom numbers generated by the Philox4x32-10
+      counter-based RNG. See the module-level notes for :mod:`PhiloxRandom`.
+
+      Each value in the stream is computed from one 128-bit Philox output,
+      so every supported type (up to `complex(128)`) takes one counter value.
+      Generated reals are in [0,1], and both 0.0 and 1.0 are possible, as
+      with :class:`~PCGRandom.RandomStream`. Integers within bounds are
+      produced by rejection sampling, so they are not biased.
+
+      Like the other RNGs in this module, it is not suitable for generating
+      key material for encryption.
+    */
+    class PhiloxRandomStream {
+      /*
+        Specifies the type of value generated by the PhiloxRandomStream.
+        All numeric types are supported: `int`, `uint`, `real`, `imag`,
+        `complex`, and `bool` types of all sizes.
+      */
+      type eltType;
+
+      /*
+        The seed value for the PRNG. It is used as the Philox key.
+      */
+      const seed: int(64);
+
+      /*
+        Indicates whether or not the PhiloxRandomStream needs to be
+        parallel-safe by default. When `true`, the position in the stream
+        is kept in an atomic so that multiple tasks can draw from it without
+        a lock.
+      */
+      param parSafe: bool = true;
+
+      /*
+        Creates a new stream of random numbers using the specified seed
+        and parallel safety.
+
+        :arg eltType: The element type to be generated.
+        :type eltType: `type`
+
+        :arg seed: The seed to use for the PRNG.  Defaults to
+          `currentTime` from :type:`RandomSupport.SeedGenerator`.
+          Can be any int(64) value.
+        :type seed: `int(64)`
+
+        :arg parSafe: The parallel safety setting.  Defaults to `true`.
+        :type parSafe: `bool`
+
+      */
+      proc init(type eltType,
+                seed: int(64) = SeedGenerator.currentTime,
+                param parSafe: bool = true) {
+        this.eltType = eltType;
+        this.seed = seed;
+        this.parSafe = parSafe;
+        this.complete();
+        PhiloxRandomStreamPrivate_setCount(1);
+      }
+
+      // Returns the current position and moves past the next n values.
+      pragma "no doc"
+      inline proc PhiloxRandomStreamPrivate_claim(n: int(64)): int(64) {
+        if parSafe {
+          return PhiloxRandomStreamPrivate_count.fetchAdd(n);
+        } else {
+          const ret = PhiloxRandomStreamPrivate_count;
+          PhiloxRandomStreamPrivate_count += n;
+          return ret;
+        }
+      }
+
+      pragma "no doc"
+      inline proc PhiloxRandomStreamPrivate_setCount(n: int(64)) {
+        if parSafe then
+          PhiloxRandomStreamPrivate_count.write(n);
+        else
+          PhiloxRandomStreamPrivate_count = n;
+      }
+
+      /*
+        Returns the next value in the random stream.
+
+        :arg resultType: the type of the result. Defaults to :type:`eltType`.
+        :returns: The next value in the random stream as type `resultType`.
+       */
+      proc getNext(type resultType=eltType): resultType {
+        return philoxValue(resultType, seed,
+                           PhiloxRandomStreamPrivate_claim(1));
+      }
+
+      /*
+        Return the next random value but within a particular range.
+        Returns a number in [`min`, `max`] (inclusive). Halts if checks are
+        enabled and ``min > max``.
+       */
+      proc getNext(min: eltType, max:eltType): eltType {
+        return getNext(eltType, min, max);
+      }
+
+      /*
+        As with getNext(min, max) but allows specifying the result type.
+       */
+      proc getNext(type resultType,
+                   min: resultType, max:resultType): resultType {
+        if boundsChecking && min > max then
+          HaltWrappers.boundsCheckHalt("Cannot generate random numbers within empty range: [" + min + ", " + max + "]");
+
+        return philoxBounded(resultType, seed,
+                             PhiloxRandomStreamPrivate_claim(1), min, max);
+      }
+
+      /*
+        Advances/rewinds the stream to the `n`-th value in the sequence.
+        The first value is with n=1.  n must be > 0, otherwise an
+        IllegalArgumentError is thrown.
+
+        :arg n: The position in the stream to skip to.  Must be > 0.
+        :type n: `integral`
+       */
+      proc skipToNth(n: integral) throws {
+        if n <= 0 then
+          throw new owned IllegalArgumentError("PhiloxRandomStream.skipToNth(n) called with non-positive 'n' value " + n);
+        PhiloxRandomStreamPrivate_setCount(n);
+      }
+
+      /*
+        Advance/rewind the stream to the `n`-th value and return it
+        (advancing the stream by one).  n must be > 0, otherwise an
+        IllegalArgumentError is thrown.  This is equivalent to
+        :proc:`skipToNth()` followed by :proc:`getNext()`.
+
+        :arg n: The position in the stream to skip to.  Must be > 0.
+        :type n: `integral`
+
+        :returns: The `n`-th value in the random stream as type :type:`eltType`.
+       */
+      proc getNth(n: integral): eltType throws {
+        if n <= 0 then
+          throw new owned IllegalArgumentError("PhiloxRandomStream.getNth(n) called with non-positive 'n' value " + n);
+        PhiloxRandomStreamPrivate_setCount(n + 1);
+        return philoxValue(eltType, seed, n);
+      }
+
+      /*
+        Fill the argument array with pseudorandom values.  This method is
+        identical to the standalone :proc:`~Random.fillRandom` procedure,
+        except that it consumes random values from the
+        :class:`PhiloxRandomStream` object on which it's invoked rather
+        than creating a new stream for the purpose of the call.
+
+        Each element is computed from its position in the array, so for a
+        distributed array every locale fills its own elements without
+        communicating.
+
+        :arg arr: The array to be filled
+        :type arr: [] :type:`eltType`
+      */
+      proc fillRandom(arr: [] eltType) {
+        const start = PhiloxRandomStreamPrivate_claim(arr.size);
+        const mySeed = seed;
+        if arr.rank == 1 && !arr.stridable {
+          const low = arr.domain.low;
+          forall (x, i) in zip(arr, arr.domain) do
+            x = philoxValue(eltType, mySeed, start + (i - low):int(64));
+        } else {
+          forall (x, i) in zip(arr, arr.domain) do
+            x = philoxValue(eltType, mySeed,
+                            start + arr.domain.indexOrder(i):int(64));
+        }
+      }
+
+      pragma "no doc"
+      proc fillRandom(arr: []) {
+        compilerError("PhiloxRandomStream(eltType=", eltType:string,
+                      ") can only be used to fill arrays of ", eltType:string);
+      }
+
+      /*
+     Returns a random sample from a given 1-D array, ``arr``.
+     See :proc:`~PCGRandom.RandomStream.choice` for the arguments.
+     */
+      proc choice(arr: [], size:?sizeType=_void, replace=true, prob:?probType=_void)
+        throws
+      {
+        return _choice(this, arr, size=size, replace=replace, prob=prob);
+      }
+
+      /* Randomly shuffle a 1-D array.
+
+         Arrays with at least 65536 elements are shuffled in parallel, and
+         distributed arrays are shuffled on the locales that own them.
+       */
+      proc shuffle(arr: [?D] ?eltType ) {
+
+        if D.rank != 1 then
+          compilerError("Shuffle requires 1-D array");
+
+        const low = D.low,
+              stride = abs(D.stride),
+              size = D.size:int(64);
+
+        const start = PhiloxRandomStreamPrivate_claim(size);
+
+        if size >= _parallelShuffleMinSize {
+          _parallelShuffle(arr, philoxValue(int(64), seed, start));
+          return;
+        }
+
+        // Fisher-Yates shuffle
+        for i in 0..#size by -1 {
+          var k = philoxBoundedUint(seed, start + size - 1 - i,
+                                    i:uint(64)):D.idxType;
+          var j = i:D.idxType;
+
+          k = k * stride + low;
+          j = j * stride + low;
+
+          arr[k] <=> arr[j];
+        }
+      }
+
+      /* Produce a random permutation, storing it in a 1-D array.
+         The resulting array will include each value from low..high
+         exactly once, where low and high refer to the array's domain.
+         As with :proc:`shuffle`, large arrays are permuted in parallel.
+         */
+      proc permutation(arr: [] eltType) {
+        if arr.domain.rank != 1 then
+          compilerError("Permutation requires 1-D array");
+
+        const low = arr.domain.dim(1).low;
+        const high = arr.domain.dim(1).high;
+
+        const start = PhiloxRandomStreamPrivate_claim((high - low + 1):int(64));
+
+        if arr.size >= _parallelShuffleMinSize {
+          _parallelPermutation(arr, philoxValue(int(64), seed, start));
+          return;
+        }
+
+        for i in low..high {
+          var j = philoxBoundedUint(seed, start + (i - low):int(64),
+                                    (i - low):uint(64)):arr.domain.idxType + low;
+          arr[i] = arr[j];
+          arr[j] = i;
+        }
+      }
+
+      /*
+
+         Returns an iterable expression for generating `D.numIndices` random
+         numbers. The RNG state will be immediately advanced by `D.numIndices`
+         before the iterable expression yields any values.
+
+         The returned iterable expression is useful in parallel contexts,
+         including standalone and zippered iteration. The domain will determine
+         the parallelization strategy.
+
+         :arg D: a domain
+         :arg resultType: the type of number to yield
+         :return: an iterable expression yielding random `resultType` values
+
+       */
+      pragma "fn returns iterator"
+      proc iterate(D: domain, type resultType=eltType) {
+        const start =
+          PhiloxRandomStreamPrivate_claim(D.numIndices.safeCast(int(64)));
+        return PhiloxRandomPrivate_iterate(resultType, D, seed, start);
+      }
+
+      // Forward the leader iterator as well.
+      pragma "no doc"
+      pragma "fn returns iterator"
+      proc iterate(D: domain, type resultType=eltType, param tag)
+        where tag == iterKind.leader
+      {
+        // Note that proc iterate() for the serial case (i.e. the one above)
+        // is going to be invoked as well, so we should not be taking
+        // any actions here other than the forwarding.
+        const start = 0;
+        return PhiloxRandomPrivate_iterate(resultType, D, seed, start, tag);
+      }
+
+      pragma "no doc"
+      override proc writeThis(f) {
+        f <~> "PhiloxRandomStream(eltType=";
+        f <~> eltType:string;
+        f <~> ", parSafe=";
+        f <~> parSafe;
+        f <~> ", seed=";
+        f <~> seed;
+        f <~> ")";
+      }
+
+      ///////////////////////////////////////////////////////// CLASS PRIVATE //
+
+      // The position of the next value in the stream (1-based)
+      pragma "no doc"
+      var PhiloxRandomStreamPrivate_count: if parSafe then atomic int(64)
+                                                      else int(64);
+    }
+
+
+    ////////////////////////////////////////////////////////// MODULE PRIVATE //
+
+    private param philoxM0 = 0xD2511F53:uint(32),
+                  philoxM1 = 0xCD9E8D57:uint(32);
+    // The Weyl sequence that bumps the key between rounds
+    private param philoxW0 = 0x9E3779B9:uint(32),
+                  philoxW1 = 0xBB67AE85:uint(32);
+
+    private inline
+    proc mulhilo32(a: uint(32), b: uint(32)) {
+      const p = a:uint(64) * b:uint(64);
+      return ((p >> 32):uint(32), p:uint(32));
+    }
+
+    /*
+      The Philox4x32-10 bijection: encrypts the 128-bit counter ``ctr`` with
+      the 64-bit ``key`` using 10 rounds.
+     */
+    proc philox4x32_10(in ctr: 4*uint(32), in key: 2*uint(32)): 4*uint(32) {
+      for r in 1..10 {
+        if r > 1 {
+          key(1) += philoxW0;
+          key(2) += philoxW1;
+        }
+        const (hi0, lo0) = mulhilo32(philoxM0, ctr(1));
+        const (hi1, lo1) = mulhilo32(philoxM1, ctr(3));
+        ctr = (hi1 ^ ctr(2) ^ key(1), lo1, hi0 ^ ctr(4) ^ key(2), lo0);
+      }
+      return ctr;
+    }
+
+    // The 128 random bits for the n-th value (1-based). Bounded integers
+    // that need more bits use further lanes of the same counter.
+    private inline
+    proc philoxBlock(seed: int(64), n: int(64), lane: uint(32) = 0) {
+      const c = (n - 1):uint(64);
+      const s = seed:uint(64);
+      return philox4x32_10((c:uint(32), (c >> 32):uint(32), lane, 0:uint(32)),
+                           (s:uint(32), (s >> 32):uint(32)));
+    }
+
+    private inline
+    proc join64(hi: uint(32), lo: uint(32)): uint(64) {
+      return (hi:uint(64) << 32) | lo:uint(64);
+    }
+
+    // returns a random number in [0, 1]
+    // where the number is a multiple of 2**-64
+    private inline
+    proc randToReal64(x: uint(64)):real(64) {
+      return ldexp(x:real(64), -64);
+    }
+
+    private inline
+    proc randToReal64(x: uint(64), min:real(64), max:real(64)):real(64) {
+      return (max-min)*randToReal64(x) + min;
+    }
+
+    // returns a random number in [0, 1]
+    // where the number is a rounded multiple of 2**-32
+    private inline
+    proc randToReal32(x: uint(32)):real(32) {
+      return ldexp(x:real(32), -32);
+    }
+
+    private inline
+    proc randToReal32(x: uint(32), min:real(32), max:real(32)):real(32) {
+      return (max-min)*randToReal32(x) + min;
+    }
+
+    // The n-th value (1-based) of the stream with this seed
+    pragma "no doc"
+    inline proc philoxValue(type resultType, seed: int(64), n: int(64)) {
+      const w = philoxBlock(seed, n);
+
+      if resultType == complex(128) {
+        return (randToReal64(join64(w(1), w(2))),
+                randToReal64(join64(w(3), w(4)))):complex(128);
+      } else if resultType == complex(64) {
+        return (randToReal32(w(1)), randToReal32(w(2))):complex(64);
+      } else if resultType == imag(64) {
+        return _r2i(randToReal64(join64(w(1), w(2))));
+      } else if resultType == imag(32) {
+        return _r2i(randToReal32(w(1)));
+      } else if resultType == real(64) {
+        return randToReal64(join64(w(1), w(2)));
+      } else if resultType == real(32) {
+        return randToReal32(w(1));
+      } else if resultType == uint(64) || resultType == int(64) {
+        return join64(w(1), w(2)):resultType;
+      } else if resultType == uint(32) || resultType == int(32) {
+        return w(1):resultType;
+      } else if resultType == uint(16) || resultType == int(16) {
+        return (w(1) >> 16):resultType;
+      } else if resultType == uint(8) || resultType == int(8) {
+        return (w(1) >> 24):resultType;
+      } else if isBoolType(resultType) {
+        return (w(1) >> 31) != 0;
+      } else {
+        compilerError("PhiloxRandomStream cannot produce " +
+                      resultType:string);
+      }
+    }
+
+    // Returns x with 0 <= x <= bound for the n-th value (1-based).
+    // Draws that would bias the result are rejected and redrawn from
+    // the other half of the block and then from further lanes.
+    pragma "no doc"
+    proc philoxBoundedUint(seed: int(64), n: int(64), bound: uint(64)): uint(64) {
+      if bound == max(uint(64)) {
+        const w = philoxBlock(seed, n);
+        return join64(w(1), w(2));
+      }
+
+      const range = bound + 1;
+      // 2**64 % range: draws below this are rejected
+      const threshold = (max(uint(64)) - range + 1) % range;
+      var lane: uint(32) = 0;
+      var x: uint(64);
+      do {
+        const w = philoxBlock(seed, n, lane);
+        x = join64(w(1), w(2));
+        if x < threshold then
+          x = join64(w(3), w(4));
+        lane += 1;
+      } while x < threshold;
+      return x % range;
+    }
+
+    // returns x with min <= x <= max (for integers)
+    // and min <= x <= max (for real/complex/imag)
+    pragma "no doc"
+    inline proc philoxBounded(type resultType, seed: int(64), n: int(64),
+                              min, max) {
+      if resultType == complex(128) {
+        const w = philoxBlock(seed, n);
+        return (randToReal64(join64(w(1), w(2)), min.re, max.re),
+                randToReal64(join64(w(3), w(4)), min.im, max.im)):complex(128);
+      } else if resultType == complex(64) {
+        const w = philoxBlock(seed, n);
+        return (randToReal32(w(1), min.re, max.re),
+                randToReal32(w(2), min.im, max.im)):complex(64);
+      } else if resultType == imag(64) {
+        const w = philoxBlock(seed, n);
+        return _r2i(randToReal64(join64(w(1), w(2)), _i2r(min), _i2r(max)));
+      } else if resultType == imag(32) {
+        const w = philoxBlock(seed, n);
+        return _r2i(randToReal32(w(1), _i2r(min), _i2r(max)));
+      } else if resultType == real(64) {
+        const w = philoxBlock(seed, n);
+        return randToReal64(join64(w(1), w(2)), min, max);
+      } else if resultType == real(32) {
+        const w = philoxBlock(seed, n);
+        return randToReal32(w(1), min, max);
+      } else if isIntegralType(resultType) {
+        return (philoxBoundedUint(seed, n, (max-min):uint(64)) +
+                min:uint(64)):resultType;
+      } else if isBoolType(resultType) {
+        compilerError("bounded rand with boolean type");
+        return false;
+      }
+    }
+
+    //
+    // iterate over outer ranges in tuple of ranges
+    //
+    private iter outer(ranges, param dim: int = 1) {
+      if dim + 1 == ranges.size {
+        for i in ranges(dim) do
+          yield (i,);
+      } else if dim + 1 < ranges.size {
+        for i in ranges(dim) do
+          for j in outer(ranges, dim+1) do
+            yield (i, (...j));
+      } else {
+        yield 0; // 1D case is a noop
+      }
+    }
+
+    //
+    // PhiloxRandomStream iterator implementation. Every value is computed
+    // from its own position, so followers need no skipping.
+    //
+    pragma "no doc"
+    iter PhiloxRandomPrivate_iterate(type resultType, D: domain, seed: int(64),
+                                     start: int(64)) {
+      var n = start;
+      for i in D {
+        yield philoxValue(resultType, seed, n);
+        n += 1;
+      }
+    }
+
+    pragma "no doc"
+    iter PhiloxRandomPrivate_iterate(type resultType, D: domain, seed: int(64),
+                                     start: int(64), param tag: iterKind)
+          where tag == iterKind.leader {
+      for block in D.these(tag=iterKind.leader) do
+        yield block;
+    }
+
+    pragma "no doc"
+    iter PhiloxRandomPrivate_iterate(type resultType, D: domain, seed: int(64),
+                 start: int(64), param tag: iterKind, followThis)
+          where tag == iterKind.follower {
+      const ZD = computeZeroBasedDomain(D);
+      const innerRange = followThis(ZD.rank);
+      for outer in outer(followThis) {
+        var myStart = start;
+        if ZD.rank > 1 then
+          myStart += ZD.indexOrder(((...outer), innerRange.low)).safeCast(int(64));
+        else
+          myStart += ZD.indexOrder(innerRange.low).safeCast(int(64));
+        if !innerRange.stridable {
+          for i in 0..#innerRange.size do
+            yield philoxValue(resultType, seed, myStart + i);
+        } else {
+          myStart -= innerRange.low.safeCast(int(64));
+          for i in innerRange do
+            yield philoxValue(resultType, seed, myStart + i.safeCast(int(64)));
+        }
+      }
+    }
+
+  } // close module PhiloxRandom
+
 
 
 } // close module Random
@@ -65,6 +65,10 @@ Lastly, you can include regular expressions in the format string for
 :proc:`~IO.readf` for searching on QIO channels using the ``%/<regexp>/``
 syntax.
 
+To test text against many regular expressions at once, compile them together
+with :proc:`compileSet` and use :proc:`regexpSet.search`, or
+:proc:`~IO.channel.searchLine` to classify each line of a channel.
+
 Regular Expression Examples
 ---------------------------
 
@@ -391,6 +395,18 @@ private extern proc qio_regexp_string_piece_isnull(ref sp:qio_regexp_string_piec
 private extern proc qio_regexp_match(const ref re:qio_regexp_t, text:c_string, textlen:int(64), startpos:int(64), endpos:int(64), anchor:c_int, submatch:_ddata(qio_regexp_string_piece_t), nsubmatch:int(64)):bool;
 private extern proc qio_regexp_replace(const ref re:qio_regexp_t, repl:c_string, repllen:int(64), text:c_string, textlen:int(64), startpos:int(64), endpos:int(64), global:bool, ref replaced:c_string, ref replaced_len:int(64)):int(64);
 
+pragma "no doc"
+extern type qio_regexp_set_t;
+pragma "no doc"
+extern proc qio_regexp_set_null():qio_regexp_set_t;
+private extern proc qio_regexp_set_create(ref options:qio_regexp_options_t, anchor:c_int, ref set:qio_regexp_set_t);
+private extern proc qio_regexp_set_add(ref set:qio_regexp_set_t, str:c_string, strlen:int(64), ref err_str:c_string):int(64);
+private extern proc qio_regexp_set_compile(ref set:qio_regexp_set_t):bool;
+private extern proc qio_regexp_set_retain(const ref set:qio_regexp_set_t);
+private extern proc qio_regexp_set_release(ref set:qio_regexp_set_t);
+private extern proc qio_regexp_set_size(const ref set:qio_regexp_set_t):int(64);
+private extern proc qio_regexp_set_match(const ref set:qio_regexp_set_t, text:c_string, textlen:int(64), matched:c_ptr(int), nmatched:int(64)):int(64);
+
 // These two could be folded together if we had a way
 // to check if a default argument was supplied
 // (or any way to use 'nil' in pass-by-ref)
@@ -542,6 +558,13 @@ proc _to_reMatch(ref p:qio_regexp_string_piece_t):reMatch {
   }
 }
 
+// search and match keep their results on the stack; this passes
+// such a buffer to qio_regexp_match.
+pragma "no doc"
+inline proc _matchBuf(ref matches: c_array) {
+  return c_ptrTo(matches[0]):_ddata(qio_regexp_string_piece_t);
+}
+
 pragma "no doc"
 inline proc !(m: reMatch) return !m.matched;
 
@@ -609,7 +632,7 @@ record regexp {
   }
 
   pragma "no doc"
-  proc _handle_captures(text: string, matches:_ddata(qio_regexp_string_piece_t), nmatches:int, ref captures) {
+  proc _handle_captures(text: string, ref matches, nmatches:int, ref captures) {
     assert(nmatches >= captures.size);
     for param i in 1..captures.size {
       var m = _to_reMatch(matches[i]);
@@ -666,20 +689,18 @@ record regexp {
       else pos = 0;
       endpos = pos + text.length;
 
-      var matches:_ddata(qio_regexp_string_piece_t);
-      var nmatches = 1 + captures.size;
-      matches = _ddata_allocate(qio_regexp_string_piece_t, nmatches);
+      param nmatches = 1 + k;
+      var matches:c_array(qio_regexp_string_piece_t, nmatches);
       var got:bool;
       if t == stringPart {
-       got = qio_regexp_match(_regexp, text.from.localize().c_str(), text.from.length, pos, endpos, QIO_REGEXP_ANCHOR_UNANCHORED, matches, nmatches);
+       got = qio_regexp_match(_regexp, text.from.localize().c_str(), text.from.length, pos, endpos, QIO_REGEXP_ANCHOR_UNANCHORED, _matchBuf(matches), nmatches);
       } else {
-       got = qio_regexp_match(_regexp, text.localize().c_str(), text.length, pos, endpos, QIO_REGEXP_ANCHOR_UNANCHORED, matches, nmatches);
+       got = qio_regexp_match(_regexp, text.localize().c_str(), text.length, pos, endpos, QIO_REGEXP_ANCHOR_UNANCHORED, _matchBuf(matches), nmatches);
       }
       // Now try to coerce the read strings into the captures.
       _handle_captures(text, matches, nmatches, captures);
       // Now return where we matched.
       ret = new reMatch(got, matches[0].offset, matches[0].len);
-      _ddata_free(matches, nmatches);
     }
     return ret;
   }
@@ -698,18 +719,16 @@ record regexp {
       else pos = 0;
       endpos = pos + text.length;
 
-      var matches:_ddata(qio_regexp_string_piece_t);
-      var nmatches = 1;
-      matches = _ddata_allocate(qio_regexp_string_piece_t, nmatches);
+      param nmatches = 1;
+      var matches:c_array(qio_regexp_string_piece_t, nmatches);
       var got:bool;
       if t == stringPart {
-       got = qio_regexp_match(_regexp, text.from.localize().c_str(), text.from.length, pos, endpos, QIO_REGEXP_ANCHOR_UNANCHORED, matches, nmatches);
+       got = qio_regexp_match(_regexp, text.from.localize().c_str(), text.from.length, pos, endpos, QIO_REGEXP_ANCHOR_UNANCHORED, _matchBuf(matches), nmatches);
       } else {
-       got = qio_regexp_match(_regexp, text.localize().c_str(), text.length, pos, endpos, QIO_REGEXP_ANCHOR_UNANCHORED, matches, nmatches);
+       got = qio_regexp_match(_regexp, text.localize().c_str(), text.length, pos, endpos, QIO_REGEXP_ANCHOR_UNANCHORED, _matchBuf(matches), nmatches);
       }
       // Now return where we matched.
       ret = new reMatch(got, matches[0].offset, matches[0].len);
-      _ddata_free(matches, nmatches);
     }
     return ret;
   }
@@ -746,20 +765,18 @@ record regexp {
       else pos = 0;
       endpos = pos + text.length;
 
-      var matches:_ddata(qio_regexp_string_piece_t);
-      var nmatches = 1 + captures.size;
-      matches = _ddata_allocate(qio_regexp_string_piece_t, nmatches);
+      param nmatches = 1 + k;
+      var matches:c_array(qio_regexp_string_piece_t, nmatches);
       var got:bool;
       if t == stringPart {
-        got = qio_regexp_match(_regexp, text.from.localize().c_str(), text.from.length, pos, endpos, QIO_REGEXP_ANCHOR_START, matches, nmatches);
+        got = qio_regexp_match(_regexp, text.from.localize().c_str(), text.from.length, pos, endpos, QIO_REGEXP_ANCHOR_START, _matchBuf(matches), nmatches);
       } else {
-        got = qio_regexp_match(_regexp, text.localize().c_str(), text.length, pos, endpos, QIO_REGEXP_ANCHOR_START, matches, nmatches);
+        got = qio_regexp_match(_regexp, text.localize().c_str(), text.length, pos, endpos, QIO_REGEXP_ANCHOR_START, _matchBuf(matches), nmatches);
       }
       // Now try to coerce the read strings into the captures.
       _handle_captures(text, matches, nmatches, captures);
       // Now return where we matched.
       ret = new reMatch(got, matches[0].offset, matches[0].len);
-      _ddata_free(matches, nmatches);
     }
     return ret;
   }
@@ -778,18 +795,16 @@ record regexp {
       else pos = 0;
       endpos = pos + text.length;
 
-      var matches:_ddata(qio_regexp_string_piece_t);
-      var nmatches = 1;
-      matches = _ddata_allocate(qio_regexp_string_piece_t, nmatches);
+      param nmatches = 1;
+      var matches:c_array(qio_regexp_string_piece_t, nmatches);
       var got:bool;
       if t == stringPart {
-       got = qio_regexp_match(_regexp, text.from.localize().c_str(), text.from.length, pos, endpos, QIO_REGEXP_ANCHOR_START, matches, nmatches);
+       got = qio_regexp_match(_regexp, text.from.localize().c_str(), text.from.length, pos, endpos, QIO_REGEXP_ANCHOR_START, _matchBuf(matches), nmatches);
       } else {
-       got = qio_regexp_match(_regexp, text.localize().c_str(), text.length, pos, endpos, QIO_REGEXP_ANCHOR_START, matches, nmatches);
+       got = qio_regexp_match(_regexp, text.localize().c_str(), text.length, pos, endpos, QIO_REGEXP_ANCHOR_START, _matchBuf(matches), nmatches);
       }
       // Now return where we matched.
       ret = new reMatch(got, matches[0].offset, matches[0].len);
-      _ddata_free(matches, nmatches);
     }
     return ret;
   }
@@ -1049,6 +1064,173 @@ inline proc _cast(type t, x: string) throws where t == regexp {
   return compile(x);
 }
 
+/*
+   Compile a set of regular expressions that can all be searched for in a
+   single pass over the text with :proc:`regexpSet.search`. This is much
+   faster than searching for each pattern in turn when there are many of
+   them. Patterns in a set do not report match offsets or capture groups,
+   only which of them matched.
+
+   :arg patterns: the string regular expressions to compile.
+                  See :ref:`regular-expression-syntax` for details.
+   :arg utf8: (optional, default true) set to `true` to create regular
+              expressions matching UTF-8; `false` for binary or ASCII only.
+   :arg posix: (optional) set to true to disable non-POSIX regular expression
+               syntax
+   :arg literal: (optional) set to true to treat each pattern as a literal
+   :arg ignorecase: (optional) set to true in order to ignore case when
+                    matching
+   :arg multiline: (optional) set to true in order to activate multiline mode
+   :arg dotnl: (optional, default false) set to true in order to allow ``.``
+               to match a newline
+   :throws BadRegexpError: if one of the patterns could not be compiled
+ */
+proc compileSet(patterns: [?D] string, utf8=true, posix=false, literal=false, /*i*/ ignorecase=false, /*m*/ multiline=false, /*s*/ dotnl=false):regexpSet throws
+  where isRectangularDom(D) && D.rank == 1 && !D.stridable
+{
+
+  if CHPL_REGEXP == "none" {
+    compilerError("Cannot use Regexp with CHPL_REGEXP=none");
+  }
+
+  var opts:qio_regexp_options_t;
+  qio_regexp_init_default_options(opts);
+  opts.utf8 = utf8;
+  opts.posix = posix;
+  opts.literal = literal;
+  opts.nocapture = true;
+  opts.ignorecase = ignorecase;
+  opts.multiline = multiline;
+  opts.dotnl = dotnl;
+
+  var ret: regexpSet;
+  ret._low = D.low;
+  qio_regexp_set_create(opts, QIO_REGEXP_ANCHOR_UNANCHORED, ret._set);
+  for pattern in patterns {
+    var err_str:c_string;
+    if qio_regexp_set_add(ret._set, pattern.localize().c_str(), pattern.length, err_str) < 0 {
+      var err_msg = err_str:string + " when compiling regexp '" + pattern + "'";
+      chpl_free_c_string(err_str);
+      throw new owned BadRegexpError(err_msg);
+    }
+  }
+  if !qio_regexp_set_compile(ret._set) {
+    throw new owned BadRegexpError("out of memory when compiling regexp set");
+  }
+  return ret;
+}
+
+/*  This record represents a compiled set of regular expressions, created
+    with :proc:`compileSet`. Like :record:`regexp`, it is reference counted,
+    so copies share the compiled set.
+  */
+pragma "ignore noinit"
+record regexpSet {
+  pragma "no doc"
+  var home: locale = here;
+  pragma "no doc"
+  var _set:qio_regexp_set_t = qio_regexp_set_null();
+  pragma "no doc"
+  var _low:int;
+
+  proc init() {
+  }
+
+  proc init=(x: regexpSet) {
+    this.home = x.home;
+    this._set = x._set;
+    this._low = x._low;
+    this.complete();
+    on home {
+      qio_regexp_set_retain(_set);
+    }
+  }
+
+  pragma "no doc"
+  proc ref deinit() {
+    on home {
+      qio_regexp_set_release(_set);
+    }
+  }
+
+  /* the number of patterns in this set */
+  proc size:int {
+    var ret:int;
+    on home {
+      ret = qio_regexp_set_size(_set);
+    }
+    return ret;
+  }
+
+  pragma "no doc"
+  proc _searchLocal(text: string, matched: c_ptr(int), nmatched: int):int {
+    return qio_regexp_set_match(_set, text.localize().c_str(), text.length, matched, nmatched);
+  }
+
+  /*
+     Search the passed text for all of the patterns in this set at once.
+
+     The indices (into the array passed to :proc:`compileSet`) of the
+     patterns that matched are stored in increasing order at the start of
+     ``found``. Since ``found`` is filled in place, it can be reused across
+     calls, for example one per line of a file, without allocating.
+
+     :arg text: a string to search
+     :arg found: where to store the indices of the matching patterns
+     :returns: the number of patterns that matched. This can be more than
+               ``found.size``, in which case only the first ``found.size``
+               indices were stored.
+   */
+  proc search(text: string, ref found: [?FD] int):int
+    where isRectangularDom(FD) && FD.rank == 1 && !FD.stridable
+  {
+    const n = found.size;
+    var nfound:int;
+    if home == here {
+      const ptr = if n > 0 then c_ptrTo(found[FD.low]) else nil:c_ptr(int);
+      nfound = _searchLocal(text, ptr, n);
+    } else {
+      var got:[0..#n] int;
+      on home {
+        var tmp:[0..#n] int;
+        const ptr = if n > 0 then c_ptrTo(tmp[0]) else nil:c_ptr(int);
+        nfound = _searchLocal(text, ptr, n);
+        got = tmp;
+      }
+      found = got;
+    }
+    for i in FD.low..#min(n, nfound) do found[i] += _low;
+    return nfound;
+  }
+
+  /*
+     :arg text: a string to search
+     :returns: true if any pattern in this set matches the text
+   */
+  proc matchesAny(text: string):bool {
+    var ret:bool;
+    on home {
+      ret = _searchLocal(text, nil, 0) > 0;
+    }
+    return ret;
+  }
+}
+
+pragma "no doc"
+proc =(ref ret:regexpSet, x:regexpSet)
+{
+  // retain -- release
+  on x.home {
+    qio_regexp_set_retain(x._set);
+  }
+  on ret.home {
+    qio_regexp_set_release(ret._set);
+  }
+  ret.home = x.home;
+  ret._set = x._set;
+  ret._low = x._low;
+}
+
 
 
 /*
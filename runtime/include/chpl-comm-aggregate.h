@@ -0,0 +1,124 @@
+/*
+ * Copyright 2004-2019 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef _chpl_comm_aggregate_h_
+#define _chpl_comm_aggregate_h_
+
+#include "chpltypes.h"
+
+//
+// Aggregation of remote writes.
+//
+// The compiler turns assignments and += updates that are the last
+// statement of a forall iteration into calls to the functions below
+// (see optimizeForallUnorderedOps.cpp).  Rather than doing a PUT (or a
+// GET and a PUT) per element, each task buffers the operations by
+// destination node and ships a whole buffer at once, where the comm
+// layer applies it with chpl_comm_agg_apply().  Buffers are flushed
+// when they fill and when the task ends (chpl_comm_task_end()), which
+// is as late as the forall semantics allow.
+//
+// Operations on the calling node are done immediately.
+//
+
+// Largest element the aggregator will buffer.
+#define CHPL_COMM_AGG_MAX_SIZE 16
+
+#define CHPL_COMM_AGG_ADD_TYPES(MACRO) \
+  MACRO(int8, int8_t)                  \
+  MACRO(int16, int16_t)                \
+  MACRO(int32, int32_t)                \
+  MACRO(int64, int64_t)                \
+  MACRO(uint8, uint8_t)                \
+  MACRO(uint16, uint16_t)              \
+  MACRO(uint32, uint32_t)              \
+  MACRO(uint64, uint64_t)              \
+  MACRO(real32, _real32)               \
+  MACRO(real64, _real64)
+
+#define _CHPL_COMM_AGG_ADD_OP(name, type) chpl_comm_agg_add_ ## name,
+
+typedef enum {
+  chpl_comm_agg_put,
+  CHPL_COMM_AGG_ADD_TYPES(_CHPL_COMM_AGG_ADD_OP)
+  chpl_comm_agg_num_ops
+} chpl_comm_agg_op_t;
+
+#undef _CHPL_COMM_AGG_ADD_OP
+
+// One buffered operation, as it is sent over the network.
+typedef struct {
+  void*    raddr;
+  int32_t  op;      // a chpl_comm_agg_op_t
+  int32_t  size;    // in bytes, for puts
+  union {
+    int8_t   int8;
+    int16_t  int16;
+    int32_t  int32;
+    int64_t  int64;
+    uint8_t  uint8;
+    uint16_t uint16;
+    uint32_t uint32;
+    uint64_t uint64;
+    _real32  real32;
+    _real64  real64;
+    unsigned char bytes[CHPL_COMM_AGG_MAX_SIZE];
+  } val;
+} chpl_comm_agg_entry_t;
+
+//
+// Buffer a PUT of size bytes from addr to raddr on node.  size must not
+// exceed CHPL_COMM_AGG_MAX_SIZE (larger PUTs are done immediately).
+//
+void chpl_comm_put_aggregated(void* addr, c_nodeid_t node, void* raddr,
+                              size_t size, int ln, int32_t fn);
+
+//
+// Buffer a non-atomic *raddr += val on node.
+//
+#define DECL_CHPL_COMM_ADD_AGGREGATED(name, type)                       \
+  void chpl_comm_add_aggregated_ ## name(c_nodeid_t node, void* raddr, \
+                                         type val, int ln, int32_t fn);
+
+CHPL_COMM_AGG_ADD_TYPES(DECL_CHPL_COMM_ADD_AGGREGATED)
+
+#undef DECL_CHPL_COMM_ADD_AGGREGATED
+
+//
+// Ship and apply all of the calling task's buffered operations, and
+// release its buffers.  Returns only when the operations are complete.
+// Called by the comm layers from chpl_comm_task_end().
+//
+void chpl_comm_agg_task_flush(void);
+
+//
+// Apply n operations to memory on the calling node.  This is what the
+// comm layer runs on the destination node for each shipped buffer.
+//
+void chpl_comm_agg_apply(chpl_comm_agg_entry_t* entries, size_t n);
+
+//
+// Apply n operations to memory on node, returning when they are
+// complete.  Each comm layer implements this.
+//
+void chpl_comm_agg_apply_on(c_nodeid_t node,
+                            chpl_comm_agg_entry_t* entries, size_t n,
+                            int ln, int32_t fn);
+
+#endif // _chpl_comm_aggregate_h_
@@ -78,4 +78,14 @@ int string_index_of(c_string x, c_string y);
 c_string string_index(c_string x, int i, int32_t lineno, int32_t filename);
 c_string string_select(c_string x, int low, int high, int stride, int32_t lineno, int32_t filename);
 
+// Searching and classifying the bytes of Chapel strings
+int64_t chpl_string_find(const uint8_t* s, int64_t len,
+                         const uint8_t* needle, int64_t needleLen);
+int64_t chpl_string_rfind(const uint8_t* s, int64_t len,
+                          const uint8_t* needle, int64_t needleLen);
+int64_t chpl_string_count(const uint8_t* s, int64_t len,
+                          const uint8_t* needle, int64_t needleLen);
+int chpl_string_all_ascii_digits(const uint8_t* s, int64_t len);
+int chpl_string_all_ascii_spaces(const uint8_t* s, int64_t len);
+
 #endif
@@ -44,4 +44,15 @@ typedef struct chpl__inPlaceBuffer_t {
 uint8_t* chpl__getInPlaceBufferData(chpl__inPlaceBuffer* buf);
 uint8_t* chpl__getInPlaceBufferDataForWrite(chpl__inPlaceBuffer* buf);
 
+//
+// Reference counts for string buffers that copies of a string share.
+// The count lives in a header of chpl_string_shared_hdr_size() bytes
+// just before the first byte of the buffer.
+//
+int64_t chpl_string_shared_hdr_size(void);
+void chpl_string_shared_init(uint8_t* buf);
+void chpl_string_shared_retain(uint8_t* buf);
+chpl_bool chpl_string_shared_release(uint8_t* buf);
+chpl_bool chpl_string_shared_unique(uint8_t* buf);
+
 #endif
@@ -33,6 +33,7 @@ typedef struct {
 // The type for runtime-managed task private data
 typedef struct {
   chpl_comm_taskPrvData_t comm_data;
+  void* comm_agg_data;  // aggregation buffers, see chpl-comm-aggregate.c
 } chpl_task_prvData_t;
 
 #endif
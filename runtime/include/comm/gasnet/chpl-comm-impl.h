@@ -20,6 +20,11 @@
 #ifndef _chpl_comm_impl_h_
 #define _chpl_comm_impl_h_
 
+//
+// Network atomics are done by AM handlers on the target node.
+//
+#include "chpl-comm-native-atomics.h"
+
 //
 // This is the comm layer sub-interface for dynamic allocation and
 // registration of memory.
@@ -29,6 +29,7 @@ typedef void* chpl_comm_nb_handle_t;
 
 typedef struct {
     chpl_cache_taskPrvData_t cache_data;
+    void* amo_nb;  // this task's unordered atomics in flight (comm-gasnet.c)
 } chpl_comm_taskPrvData_t;
 
 //
@@ -141,6 +141,54 @@ int64_t qio_regexp_replace(qio_regexp_t* regexp, const char* repl, int64_t repl_
 //
 qioerr qio_regexp_channel_match(const qio_regexp_t* regexp, const int threadsafe, struct qio_channel_s* ch, int64_t maxlen, int anchor, qio_bool can_discard, qio_bool keep_unmatched, qio_bool keep_whole_pattern, qio_regexp_string_piece_t* submatch, int64_t nsubmatch);
 
+// A set of regular expressions that are all searched for in one pass
+// over the text (backed by RE2::Set). Patterns are numbered from 0 in
+// the order they were added.
+typedef struct qio_regexp_set_s {
+  void* set;
+} qio_regexp_set_t;
+
+static inline
+qio_regexp_set_t qio_regexp_set_null(void)
+{
+  qio_regexp_set_t ret;
+  ret.set = NULL;
+  return ret;
+}
+
+// The set returned in 'set' must be released by the caller.
+void qio_regexp_set_create(const qio_regexp_options_t* options, int anchor, qio_regexp_set_t* set);
+
+// Returns the number of the added pattern, or -1 if it could not be
+// parsed, in which case *err_str is set to an error string that must be
+// freed by the caller (and was made with qio_malloc()).
+int64_t qio_regexp_set_add(qio_regexp_set_t* set, const char* str, int64_t str_len, const char** err_str);
+
+// Must be called once after all patterns were added and before matching.
+// Returns false if the set could not be compiled.
+qio_bool qio_regexp_set_compile(qio_regexp_set_t* set);
+
+void qio_regexp_set_retain(const qio_regexp_set_t* set);
+void qio_regexp_set_release(qio_regexp_set_t* set);
+
+int64_t qio_regexp_set_size(const qio_regexp_set_t* set);
+
+// Search text for all of the patterns in the set.
+// Stores the numbers of up to nmatched matching patterns, in increasing
+// order, in matched and returns the total number of patterns that
+// matched (which can be more than nmatched). The caller owns matched,
+// so the same buffer can be reused across calls.
+int64_t qio_regexp_set_match(const qio_regexp_set_t* set, const char* text, int64_t text_len, int64_t* matched, int64_t nmatched);
+
+// Read the next line (up to and including a newline, or to EOF) from
+// the channel and search it for the patterns in the set. The line is
+// matched directly in the channel buffer when it fits there. Fills in
+// matched/nmatched as qio_regexp_set_match does, returning the number
+// of matching patterns in *nfound, and the channel offset and length
+// of the line (without its newline) in *line. Returns EEOF at the end
+// of the channel.
+qioerr qio_regexp_set_channel_match_line(const qio_regexp_set_t* set, const int threadsafe, struct qio_channel_s* ch, qio_regexp_string_piece_t* line, int64_t* matched, int64_t nmatched, int64_t* nfound);
+
 #ifdef __cplusplus
 } // end extern "C"
 #endif
@@ -0,0 +1,199 @@
+/*
+ * Copyright 2004-2019 Cray Inc.
+ * Other additional copyright holders may be indicated within.
+ *
+ * The entirety of this work is licensed under the Apache License,
+ * Version 2.0 (the "License"); you may not use this file except
+ * in compliance with the License.
+ *
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Per-task buffering of aggregated remote writes.
+//
+
+#include "chplrt.h"
+
+#include "chpl-comm.h"
+#include "chpl-comm-aggregate.h"
+#include "chpl-comm-compiler-macros.h"
+#include "chpl-env.h"
+#include "chpl-mem.h"
+#include "chpl-tasks.h"
+#include "chpl-comm-no-warning-macros.h" // No warnings for chpl_comm_get etc.
+
+#include <string.h>
+
+// Default number of operations buffered per destination node.
+#define DEFAULT_BUFFER_ENTRIES 256
+
+typedef struct {
+  size_t                count;
+  chpl_comm_agg_entry_t entries[0];
+} agg_buffer_t;
+
+//
+// A task's aggregation state.  The per-node buffers are allocated the
+// first time the task sends something to that node.
+//
+typedef struct {
+  size_t        capacity;       // entries per buffer
+  agg_buffer_t* bufs[0];        // one per node, indexed by node ID
+} agg_task_data_t;
+
+
+static inline
+agg_task_data_t* get_task_data(void) {
+  chpl_task_prvData_t* prv = chpl_task_getPrvData();
+  agg_task_data_t* td = (agg_task_data_t*) prv->comm_agg_data;
+
+  if (td == NULL) {
+    td = chpl_mem_allocManyZero(1, sizeof(*td)
+                                   + chpl_numNodes * sizeof(td->bufs[0]),
+                                CHPL_RT_MD_COMM_AGG_BUFFER, 0, 0);
+    td->capacity = (size_t) chpl_env_rt_get_int("COMM_AGG_BUFFER_SIZE",
+                                                DEFAULT_BUFFER_ENTRIES);
+    if (td->capacity == 0)
+      td->capacity = 1;
+    prv->comm_agg_data = td;
+  }
+
+  return td;
+}
+
+
+static
+void flush_buffer(c_nodeid_t node, agg_buffer_t* buf, int ln, int32_t fn) {
+  if (buf->count > 0) {
+    chpl_comm_agg_apply_on(node, buf->entries, buf->count, ln, fn);
+    buf->count = 0;
+  }
+}
+
+
+//
+// Return a free entry in the calling task's buffer for node, shipping
+// the buffer first if it is full.
+//
+static inline
+chpl_comm_agg_entry_t* next_entry(c_nodeid_t node, int ln, int32_t fn) {
+  agg_task_data_t* td = get_task_data();
+  agg_buffer_t* buf = td->bufs[node];
+
+  if (buf == NULL) {
+    buf = chpl_mem_alloc(sizeof(*buf)
+                         + td->capacity * sizeof(buf->entries[0]),
+                         CHPL_RT_MD_COMM_AGG_BUFFER, ln, fn);
+    buf->count = 0;
+    td->bufs[node] = buf;
+  } else if (buf->count == td->capacity) {
+    flush_buffer(node, buf, ln, fn);
+  }
+
+  return &buf->entries[buf->count++];
+}
+
+
+void chpl_comm_put_aggregated(void* addr, c_nodeid_t node, void* raddr,
+                              size_t size, int ln, int32_t fn) {
+  chpl_comm_agg_entry_t* e;
+
+  if (node == chpl_nodeID) {
+    memmove(raddr, addr, size);
+    return;
+  }
+
+  if (size > CHPL_COMM_AGG_MAX_SIZE) {
+    chpl_comm_put(addr, node, raddr, size, -1, CHPL_COMM_UNKNOWN_ID, ln, fn);
+    return;
+  }
+
+  e = next_entry(node, ln, fn);
+  e->raddr = raddr;
+  e->op = chpl_comm_agg_put;
+  e->size = (int32_t) size;
+  memcpy(e->val.bytes, addr, size);
+}
+
+
+#define DEFINE_CHPL_COMM_ADD_AGGREGATED(name, type)                     \
+  void chpl_comm_add_aggregated_ ## name(c_nodeid_t node, void* raddr, \
+                                         type val, int ln, int32_t fn) \
+  {                                                                     \
+    chpl_comm_agg_entry_t* e;                                           \
+                                                                        \
+    if (node == chpl_nodeID) {                                          \
+      *(type*) raddr += val;                                            \
+      return;                                                           \
+    }                                                                   \
+                                                                        \
+    e = next_entry(node, ln, fn);                                       \
+    e->raddr = raddr;                                                   \
+    e->op = chpl_comm_agg_add_ ## name;                                 \
+    e->size = (int32_t) sizeof(type);                                   \
+    e->val.name = val;                                                  \
+  }
+
+CHPL_COMM_AGG_ADD_TYPES(DEFINE_CHPL_COMM_ADD_AGGREGATED)
+
+#undef DEFINE_CHPL_COMM_ADD_AGGREGATED
+
+
+void chpl_comm_agg_task_flush(void) {
+  chpl_task_prvData_t* prv = chpl_task_getPrvData();
+  agg_task_data_t* td = (agg_task_data_t*) prv->comm_agg_data;
+  c_nodeid_t node;
+
+  if (td == NULL)
+    return;
+
+  for (node = 0; node < chpl_numNodes; node++) {
+    if (td->bufs[node] != NULL) {
+      flush_buffer(node, td->bufs[node], 0, 0);
+      chpl_mem_free(td->bufs[node], 0, 0);
+    }
+  }
+
+  prv->comm_agg_data = NULL;
+  chpl_mem_free(td, 0, 0);
+}
+
+
+static inline
+void apply_entry(void* addr, chpl_comm_agg_entry_t* e) {
+  switch (e->op) {
+  case chpl_comm_agg_put:
+    memcpy(addr, e->val.bytes, e->size);
+    break;
+
+#define APPLY_ADD_CASE(name, type)                                      \
+  case chpl_comm_agg_add_ ## name:                                      \
+    *(type*) addr += e->val.name;                                       \
+    break;
+
+  CHPL_COMM_AGG_ADD_TYPES(APPLY_ADD_CASE)
+
+#undef APPLY_ADD_CASE
+
+  default:
+    chpl_internal_error("unknown aggregated operation");
+  }
+}
+
+
+void chpl_comm_agg_apply(chpl_comm_agg_entry_t* entries, size_t n) {
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    apply_entry(entries[i].raddr, &entries[i]);
+}
+
@@ -32,6 +32,7 @@
  *
  */
 #include <stdarg.h>
+#include <string.h>
 #include "chplrt.h"
 #include "sys_basic.h"
 #include "chpl-mem.h"
@@ -191,3 +192,252 @@ string_contains(c_string x, c_string y) {
 }
 
 
+//
+// Searching byte buffers
+//
+// These back the search methods of Chapel strings.  Buffers are not
+// NUL-terminated, and offsets are 0-based.
+//
+// Substring searches use the approach from Wojciech Mula's "SIMD-friendly
+// algorithms for substring searching": compare a vector of bytes against
+// the first byte of the needle and the bytes needleLen-1 further along
+// against its last byte.  Only the positions where both match are checked
+// with memcmp.  The vector width is 32 bytes with AVX2 and 16 with SSE2,
+// and other targets use a scalar loop with the same filter.
+//
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define CHPL_STR_VEC_WIDTH 32
+typedef __m256i chpl_str_vec_t;
+#define chpl_str_vec_splat(b)   _mm256_set1_epi8((char)(b))
+#define chpl_str_vec_load(p)    _mm256_loadu_si256((const __m256i*)(p))
+#define chpl_str_vec_eqmask(a, b) \
+  ((uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8((a), (b))))
+#define chpl_str_vec_orbits(a) \
+  ((uint32_t)_mm256_movemask_epi8(a))
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define CHPL_STR_VEC_WIDTH 16
+typedef __m128i chpl_str_vec_t;
+#define chpl_str_vec_splat(b)   _mm_set1_epi8((char)(b))
+#define chpl_str_vec_load(p)    _mm_loadu_si128((const __m128i*)(p))
+#define chpl_str_vec_eqmask(a, b) \
+  ((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8((a), (b))))
+#define chpl_str_vec_orbits(a) \
+  ((uint32_t)_mm_movemask_epi8(a))
+#endif
+
+// Returns a bit mask of the positions i..i+W-1 where the needle's first and
+// last bytes match.
+#ifdef CHPL_STR_VEC_WIDTH
+static inline
+uint32_t candidates(const uint8_t* s, int64_t i, int64_t lastOff,
+                    chpl_str_vec_t first, chpl_str_vec_t last) {
+  return chpl_str_vec_eqmask(chpl_str_vec_load(s + i), first) &
+         chpl_str_vec_eqmask(chpl_str_vec_load(s + i + lastOff), last);
+}
+#endif
+
+static inline
+chpl_bool matchesAt(const uint8_t* s, int64_t i,
+                    const uint8_t* needle, int64_t needleLen) {
+  // The first and last bytes are already known to match
+  return needleLen <= 2 ||
+         memcmp(s + i + 1, needle + 1, needleLen - 2) == 0;
+}
+
+int64_t chpl_string_find(const uint8_t* s, int64_t len,
+                         const uint8_t* needle, int64_t needleLen) {
+  int64_t i = 0;
+  int64_t lastOff = needleLen - 1;
+
+  if (needleLen == 0)
+    return 0;
+  if (needleLen > len)
+    return -1;
+
+  if (needleLen == 1) {
+    const uint8_t* p = memchr(s, needle[0], len);
+    return p ? p - s : -1;
+  }
+
+#ifdef CHPL_STR_VEC_WIDTH
+  {
+    const chpl_str_vec_t first = chpl_str_vec_splat(needle[0]);
+    const chpl_str_vec_t last = chpl_str_vec_splat(needle[lastOff]);
+
+    for ( ; i + lastOff + CHPL_STR_VEC_WIDTH <= len;
+          i += CHPL_STR_VEC_WIDTH) {
+      uint32_t mask = candidates(s, i, lastOff, first, last);
+      while (mask != 0) {
+        int bit = __builtin_ctz(mask);
+        if (matchesAt(s, i + bit, needle, needleLen))
+          return i + bit;
+        mask &= mask - 1;
+      }
+    }
+  }
+#endif
+
+  for ( ; i + lastOff < len; i++) {
+    if (s[i] == needle[0] && s[i + lastOff] == needle[lastOff] &&
+        matchesAt(s, i, needle, needleLen))
+      return i;
+  }
+
+  return -1;
+}
+
+int64_t chpl_string_rfind(const uint8_t* s, int64_t len,
+                          const uint8_t* needle, int64_t needleLen) {
+  int64_t lastOff = needleLen - 1;
+  int64_t end;  // one past the last starting position left to check
+
+  if (needleLen == 0)
+    return len;
+  if (needleLen > len)
+    return -1;
+
+  end = len - lastOff;
+
+#ifdef CHPL_STR_VEC_WIDTH
+  {
+    const chpl_str_vec_t first = chpl_str_vec_splat(needle[0]);
+    const chpl_str_vec_t last = chpl_str_vec_splat(needle[lastOff]);
+
+    for ( ; end >= CHPL_STR_VEC_WIDTH; end -= CHPL_STR_VEC_WIDTH) {
+      int64_t i = end - CHPL_STR_VEC_WIDTH;
+      uint32_t mask = candidates(s, i, lastOff, first, last);
+      while (mask != 0) {
+        int bit = 31 - __builtin_clz(mask);
+        if (matchesAt(s, i + bit, needle, needleLen))
+          return i + bit;
+        mask &= ~((uint32_t)1 << bit);
+      }
+    }
+  }
+#endif
+
+  while (end > 0) {
+    int64_t i = end - 1;
+    if (s[i] == needle[0] && s[i + lastOff] == needle[lastOff] &&
+        matchesAt(s, i, needle, needleLen))
+      return i;
+    end--;
+  }
+
+  return -1;
+}
+
+// Counts every position where needle occurs, including overlapping ones.
+int64_t chpl_string_count(const uint8_t* s, int64_t len,
+                          const uint8_t* needle, int64_t needleLen) {
+  int64_t i = 0;
+  int64_t lastOff = needleLen - 1;
+  int64_t count = 0;
+
+  if (needleLen == 0)
+    return len + 1;
+  if (needleLen > len)
+    return 0;
+
+#ifdef CHPL_STR_VEC_WIDTH
+  {
+    const chpl_str_vec_t first = chpl_str_vec_splat(needle[0]);
+    const chpl_str_vec_t last = chpl_str_vec_splat(needle[lastOff]);
+
+    for ( ; i + lastOff + CHPL_STR_VEC_WIDTH <= len;
+          i += CHPL_STR_VEC_WIDTH) {
+      uint32_t mask = candidates(s, i, lastOff, first, last);
+      if (needleLen <= 2) {
+        count += __builtin_popcount(mask);
+        continue;
+      }
+      while (mask != 0) {
+        int bit = __builtin_ctz(mask);
+        if (matchesAt(s, i + bit, needle, needleLen))
+          count++;
+        mask &= mask - 1;
+      }
+    }
+  }
+#endif
+
+  for ( ; i + lastOff < len; i++) {
+    if (s[i] == needle[0] && s[i + lastOff] == needle[lastOff] &&
+        matchesAt(s, i, needle, needleLen))
+      count++;
+  }
+
+  return count;
+}
+
+//
+// Classifying ASCII bytes
+//
+// These return 1 if every byte is in the class and 0 if an ASCII byte is
+// not.  They return -1 when they reach a byte whose class depends on the
+// locale (any non-ASCII byte) before deciding, so that the caller can
+// fall back to classifying codepoints.
+//
+
+static inline
+int asciiSpaceClass(uint8_t c) {
+  if (c == ' ' || (c >= '\t' && c <= '\r'))
+    return 1;
+  // iswspace() treats the information separators as spaces in some locales
+  if (c >= 0x80 || (c >= 0x1c && c <= 0x1f))
+    return -1;
+  return 0;
+}
+
+static inline
+int asciiDigitClass(uint8_t c) {
+  if (c >= '0' && c <= '9')
+    return 1;
+  if (c >= 0x80)
+    return -1;
+  return 0;
+}
+
+int chpl_string_all_ascii_digits(const uint8_t* s, int64_t len) {
+  int64_t i = 0;
+
+#ifdef CHPL_STR_VEC_WIDTH
+  for ( ; i + CHPL_STR_VEC_WIDTH <= len; i += CHPL_STR_VEC_WIDTH) {
+    // Subtracting '0' maps the digits to 0..9.  All other bytes, including
+    // the non-ASCII ones, become larger when viewed as unsigned.
+#if defined(__AVX2__)
+    __m256i v = _mm256_sub_epi8(chpl_str_vec_load(s + i),
+                                _mm256_set1_epi8('0'));
+    __m256i ok = _mm256_cmpeq_epi8(_mm256_min_epu8(v, _mm256_set1_epi8(9)),
+                                   v);
+#else
+    __m128i v = _mm_sub_epi8(chpl_str_vec_load(s + i), _mm_set1_epi8('0'));
+    __m128i ok = _mm_cmpeq_epi8(_mm_min_epu8(v, _mm_set1_epi8(9)), v);
+#endif
+    if (chpl_str_vec_orbits(ok) !=
+        (uint32_t)(((uint64_t)1 << CHPL_STR_VEC_WIDTH) - 1))
+      break;  // let the scalar loop find the byte that decides
+  }
+#endif
+
+  for ( ; i < len; i++) {
+    int c = asciiDigitClass(s[i]);
+    if (c != 1)
+      return c;
+  }
+  return 1;
+}
+
+int chpl_string_all_ascii_spaces(const uint8_t* s, int64_t len) {
+  int64_t i = 0;
+
+  for ( ; i < len; i++) {
+    int c = asciiSpaceClass(s[i]);
+    if (c != 1)
+      return c;
+  }
+  return 1;
+}
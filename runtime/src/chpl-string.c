@@ -20,6 +20,7 @@
 #include "chplrt.h"
 #include "chpl-string.h"
 #include "chpl-gen-includes.h"
+#include "chpl-atomics.h"
 
 struct chpl_chpl____wide_chpl_string_s {
   chpl_localeID_t locale;
@@ -126,3 +127,40 @@ uint8_t* chpl__getInPlaceBufferData(chpl__inPlaceBuffer* buf) {
 uint8_t* chpl__getInPlaceBufferDataForWrite(chpl__inPlaceBuffer* buf) {
   return chpl__getInPlaceBufferData(buf);
 }
+
+//
+// The header is rounded up to a multiple of 16 bytes so that the buffer
+// after it is as well aligned as the allocation itself.
+//
+#define SHARED_HDR_SIZE ((sizeof(atomic_int_least64_t) + 15) & ~(size_t) 15)
+
+static inline
+atomic_int_least64_t* sharedCount(uint8_t* buf) {
+  return (atomic_int_least64_t*) (buf - SHARED_HDR_SIZE);
+}
+
+int64_t chpl_string_shared_hdr_size(void) {
+  return SHARED_HDR_SIZE;
+}
+
+void chpl_string_shared_init(uint8_t* buf) {
+  atomic_init_int_least64_t(sharedCount(buf), 1);
+}
+
+void chpl_string_shared_retain(uint8_t* buf) {
+  (void) atomic_fetch_add_int_least64_t(sharedCount(buf), 1);
+}
+
+// Returns true if this was the last reference, in which case the
+// caller frees the buffer.
+chpl_bool chpl_string_shared_release(uint8_t* buf) {
+  if (atomic_fetch_sub_int_least64_t(sharedCount(buf), 1) == 1) {
+    atomic_destroy_int_least64_t(sharedCount(buf));
+    return true;
+  }
+  return false;
+}
+
+chpl_bool chpl_string_shared_unique(uint8_t* buf) {
+  return atomic_load_int_least64_t(sharedCount(buf)) == 1;
+}
@@ -24,6 +24,7 @@
 #include "gasnet_coll.h"
 #include "gasnet_tools.h"
 #include "chpl-comm.h"
+#include "chpl-comm-aggregate.h"
 #include "chpl-comm-diags.h"
 #include "chpl-comm-callbacks.h"
 #include "chpl-comm-callbacks-internal.h"
@@ -250,7 +251,11 @@ typedef enum {
   SHUTDOWN,             // tell nodes to get ready for shutdown
   BCAST_SEGINFO,        // broadcast for segment info table
   DO_REPLY_PUT,         // do a PUT here from another locale
-  DO_COPY_PAYLOAD       // copy AM payload to another address
+  DO_COPY_PAYLOAD,      // copy AM payload to another address
+  DO_AGG_APPLY,         // apply a buffer of aggregated remote writes
+  DO_AMO,               // do an atomic operation here for another locale
+  AMO_REPLY,            // return the result of an atomic operation
+  AMO_NB_ACK            // acknowledge an unordered atomic operation
 } AM_handler_function_idx_t;
 
 static void AM_fork_fast(gasnet_token_t token, void* buf, size_t nbytes) {
@@ -586,6 +591,195 @@ void AM_copy_payload(gasnet_token_t token, void* buf, size_t nbytes,
   GASNET_Safe(gasnet_AMReplyShort2(token, SIGNAL, ack0, ack1));
 }
 
+// Apply the aggregated remote writes in the payload of this active
+// message (see chpl-comm-aggregate.h).
+static
+void AM_agg_apply(gasnet_token_t token, void* buf, size_t nbytes,
+                  gasnet_handlerarg_t ack0, gasnet_handlerarg_t ack1)
+{
+  assert(nbytes % sizeof(chpl_comm_agg_entry_t) == 0);
+
+  chpl_comm_agg_apply((chpl_comm_agg_entry_t*) buf,
+                      nbytes / sizeof(chpl_comm_agg_entry_t));
+
+  GASNET_Safe(gasnet_AMReplyShort2(token, SIGNAL, ack0, ack1));
+}
+
+//
+// Network atomics.  The requesting node sends the operation in a
+// Medium AM and the handler on the target node does it with a processor
+// atomic, so there is no task to create and no on-statement overhead.
+//
+typedef enum {
+  amo_write,
+  amo_read,
+  amo_xchg,
+  amo_cmpxchg,
+  amo_and,
+  amo_or,
+  amo_xor,
+  amo_add,
+  amo_sub
+} amo_op_t;
+
+typedef enum {
+  amo_int32,
+  amo_int64,
+  amo_uint32,
+  amo_uint64,
+  amo_real32,
+  amo_real64
+} amo_type_t;
+
+typedef union {
+  int32_t     i32;
+  int64_t     i64;
+  uint32_t    u32;
+  uint64_t    u64;
+  _real32     r32;
+  _real64     r64;
+  chpl_bool32 b32;
+} amo_datum_t;
+
+typedef struct {
+  void*       obj;     // target of the operation, on the handler's node
+  void*       result;  // amo_datum_t for the result on the requester, or NULL
+  void*       ack;     // done_t to signal on the requester
+  int32_t     op;      // an amo_op_t
+  int32_t     type;    // an amo_type_t
+  chpl_bool32 nb;      // unordered, so ack with AMO_NB_ACK
+  amo_datum_t opnd1;
+  amo_datum_t opnd2;
+} amo_req_t;
+
+//
+// Unordered atomics in flight.  Each task counts the ones it has issued
+// in its own done_t, and the node counts all of them so that a global
+// fence can wait for every task's operations.
+//
+typedef struct {
+  done_t         done;    // acknowledged so far
+  uint_least32_t issued;
+} amo_nb_t;
+
+static atomic_uint_least64_t amo_nb_issued_all;
+static atomic_uint_least64_t amo_nb_acked_all;
+
+#define DO_CPU_AMO_COMMON(_t, _m)                                       \
+    case amo_write:                                                     \
+      atomic_store_##_t((atomic_##_t*) obj, opnd1->_m);                 \
+      break;                                                            \
+    case amo_read:                                                      \
+      result->_m = atomic_load_##_t((atomic_##_t*) obj);                \
+      break;                                                            \
+    case amo_xchg:                                                      \
+      result->_m = atomic_exchange_##_t((atomic_##_t*) obj, opnd1->_m); \
+      break;                                                            \
+    case amo_cmpxchg:                                                   \
+      result->b32 =                                                     \
+        atomic_compare_exchange_strong_##_t((atomic_##_t*) obj,         \
+                                            opnd1->_m, opnd2->_m);      \
+      break;                                                            \
+    case amo_add:                                                       \
+      result->_m = atomic_fetch_add_##_t((atomic_##_t*) obj, opnd1->_m);\
+      break;                                                            \
+    case amo_sub:                                                       \
+      result->_m = atomic_fetch_sub_##_t((atomic_##_t*) obj, opnd1->_m);\
+      break;
+
+#define DO_CPU_AMO_INT(_t, _m)                                          \
+  switch (op) {                                                         \
+    DO_CPU_AMO_COMMON(_t, _m)                                           \
+    case amo_and:                                                       \
+      result->_m = atomic_fetch_and_##_t((atomic_##_t*) obj, opnd1->_m);\
+      break;                                                            \
+    case amo_or:                                                        \
+      result->_m = atomic_fetch_or_##_t((atomic_##_t*) obj, opnd1->_m); \
+      break;                                                            \
+    case amo_xor:                                                       \
+      result->_m = atomic_fetch_xor_##_t((atomic_##_t*) obj, opnd1->_m);\
+      break;                                                            \
+    default:                                                            \
+      chpl_internal_error("unknown atomic operation");                  \
+  }
+
+#define DO_CPU_AMO_REAL(_t, _m)                                         \
+  switch (op) {                                                         \
+    DO_CPU_AMO_COMMON(_t, _m)                                           \
+    default:                                                            \
+      chpl_internal_error("unsupported atomic operation on a real");    \
+  }
+
+//
+// Do an atomic operation on memory on this node.  The previous value
+// (or for cmpxchg, whether the exchange happened) goes in *result.
+//
+static inline
+void do_cpu_amo(void* obj, amo_op_t op, amo_type_t type,
+                const amo_datum_t* opnd1, const amo_datum_t* opnd2,
+                amo_datum_t* result) {
+  switch (type) {
+  case amo_int32:  DO_CPU_AMO_INT(int_least32_t, i32);  break;
+  case amo_int64:  DO_CPU_AMO_INT(int_least64_t, i64);  break;
+  case amo_uint32: DO_CPU_AMO_INT(uint_least32_t, u32); break;
+  case amo_uint64: DO_CPU_AMO_INT(uint_least64_t, u64); break;
+  case amo_real32: DO_CPU_AMO_REAL(_real32, r32);       break;
+  case amo_real64: DO_CPU_AMO_REAL(_real64, r64);       break;
+  default:
+    chpl_internal_error("unknown atomic operation type");
+  }
+}
+
+#undef DO_CPU_AMO_COMMON
+#undef DO_CPU_AMO_INT
+#undef DO_CPU_AMO_REAL
+
+// Do an atomic operation for another node and reply with the result,
+// or just an acknowledgement if the requester doesn't want it.
+static void AM_amo(gasnet_token_t token, void* buf, size_t nbytes) {
+  amo_req_t* req = buf;
+  amo_datum_t result;
+
+  assert(nbytes == sizeof(amo_req_t));
+
+  do_cpu_amo(req->obj, (amo_op_t) req->op, (amo_type_t) req->type,
+             &req->opnd1, &req->opnd2, &result);
+
+  if (req->nb) {
+    GASNET_Safe(gasnet_AMReplyShort2(token, AMO_NB_ACK,
+                                     Arg0(req->ack), Arg1(req->ack)));
+  } else if (req->result == NULL) {
+    GASNET_Safe(gasnet_AMReplyShort2(token, SIGNAL,
+                                     Arg0(req->ack), Arg1(req->ack)));
+  } else {
+    GASNET_Safe(gasnet_AMReplyShort6(token, AMO_REPLY,
+                                     Arg0(req->ack), Arg1(req->ack),
+                                     Arg0(req->result), Arg1(req->result),
+                                     Arg0(result.u64), Arg1(result.u64)));
+  }
+}
+
+// Store the result of an atomic operation and signal its done_t.
+static void AM_amo_reply(gasnet_token_t token,
+                         gasnet_handlerarg_t ack0, gasnet_handlerarg_t ack1,
+                         gasnet_handlerarg_t res0, gasnet_handlerarg_t res1,
+                         gasnet_handlerarg_t val0, gasnet_handlerarg_t val1) {
+  amo_datum_t* result = (amo_datum_t*) get_ptr_from_args(res0, res1);
+
+  result->u64 = (uint64_t) get_uintptr_from_args(val0, val1);
+  AM_signal(token, ack0, ack1);
+}
+
+// Count the completion of an unordered atomic operation for the task
+// that issued it, and for the node.
+static void AM_amo_nb_ack(gasnet_token_t token,
+                          gasnet_handlerarg_t ack0, gasnet_handlerarg_t ack1) {
+  done_t* done = (done_t*) get_ptr_from_args(ack0, ack1);
+
+  atomic_fetch_add_uint_least32_t(&done->count, 1);
+  atomic_fetch_add_uint_least64_t(&amo_nb_acked_all, 1);
+}
+
 static gasnet_handlerentry_t ftable[] = {
   {FORK,          AM_fork},
   {FORK_SMALL,    AM_fork_small},
@@ -604,7 +798,11 @@ static gasnet_handlerentry_t ftable[] = {
   {SHUTDOWN,      AM_shutdown},
   {BCAST_SEGINFO, AM_bcast_seginfo},
   {DO_REPLY_PUT,  AM_reply_put},
-  {DO_COPY_PAYLOAD, AM_copy_payload}
+  {DO_COPY_PAYLOAD, AM_copy_payload},
+  {DO_AGG_APPLY,  AM_agg_apply},
+  {DO_AMO,        AM_amo},
+  {AMO_REPLY,     AM_amo_reply},
+  {AMO_NB_ACK,    AM_amo_nb_ack}
 };
 
 //
@@ -782,6 +980,9 @@ void chpl_comm_init(int *argc_p, char ***argv_p) {
   set_num_comm_domains();
   assert(sizeof(gasnet_handlerarg_t)==sizeof(uint32_t));
 
+  atomic_init_uint_least64_t(&amo_nb_issued_all, 0);
+  atomic_init_uint_least64_t(&amo_nb_acked_all, 0);
+
   gasnet_init(argc_p, argv_p);
   chpl_nodeID = gasnet_mynode();
   chpl_numNodes = gasnet_nodes();
@@ -1571,10 +1772,241 @@ void chpl_comm_make_progress(void)
   gasnet_AMPoll();
 }
 
-void chpl_comm_task_end(void) { }
+void chpl_comm_task_end(void) {
+  chpl_comm_agg_task_flush();
+  chpl_comm_atomic_unordered_task_fence();
+}
+
+void chpl_comm_agg_apply_on(c_nodeid_t node,
+                            chpl_comm_agg_entry_t* entries, size_t n,
+                            int ln, int32_t fn) {
+  size_t max_chunk = gasnet_AMMaxMedium() / sizeof(entries[0]);
+  size_t num_chunks = (n + max_chunk - 1) / max_chunk;
+  size_t start;
+  done_t done;
+
+  if (n == 0)
+    return;
+
+  // Send all the chunks before waiting for any of them, so that they
+  // are applied on the remote node while we are still sending.
+  init_done_obj(&done, num_chunks);
+
+  for (start = 0; start < n; start += max_chunk) {
+    size_t this_n = n - start;
+    if (this_n > max_chunk) {
+      this_n = max_chunk;
+    }
+
+    GASNET_Safe(gasnet_AMRequestMedium2(node, DO_AGG_APPLY,
+                                        &entries[start],
+                                        this_n * sizeof(entries[0]),
+                                        Arg0(&done), Arg1(&done)));
+  }
+
+  wait_done_obj(&done);
+}
 
 void chpl_comm_gasnet_help_register_global_var(int i, wide_ptr_t wide_addr) {
   if (chpl_nodeID == 0) {
     ((wide_ptr_t*)seginfo_table[0].addr)[i] = wide_addr;
   }
 }
+
+
+////////////////////////////////////////
+//
+// Interface: network atomics
+//
+
+static inline
+void do_amo(c_nodeid_t node, void* object, amo_op_t op, amo_type_t type,
+            size_t size, const void* operand1, const void* operand2,
+            void* result) {
+  amo_req_t req;
+  amo_datum_t res;
+  done_t done;
+
+  req.opnd1.u64 = 0;
+  req.opnd2.u64 = 0;
+  if (operand1 != NULL)
+    memcpy(&req.opnd1, operand1, size);
+  if (operand2 != NULL)
+    memcpy(&req.opnd2, operand2, size);
+
+  if (node == chpl_nodeID) {
+    do_cpu_amo(object, op, type, &req.opnd1, &req.opnd2, &res);
+  } else {
+    req.obj = object;
+    req.result = (result == NULL) ? NULL : &res;
+    req.ack = &done;
+    req.op = op;
+    req.type = type;
+    req.nb = false;
+
+    init_done_obj(&done, 1);
+    GASNET_Safe(gasnet_AMRequestMedium0(node, DO_AMO, &req, sizeof(req)));
+    wait_done_obj(&done);
+  }
+
+  if (result != NULL)
+    memcpy(result, &res, (op == amo_cmpxchg) ? sizeof(chpl_bool32) : size);
+}
+
+static inline
+amo_nb_t* get_amo_nb(void) {
+  chpl_task_prvData_t* prv = chpl_task_getPrvData();
+  amo_nb_t* nb = (amo_nb_t*) prv->comm_data.amo_nb;
+
+  if (nb == NULL) {
+    nb = chpl_mem_alloc(sizeof(*nb), CHPL_RT_MD_COMM_UTIL, 0, 0);
+    init_done_obj(&nb->done, 0);
+    nb->issued = 0;
+    prv->comm_data.amo_nb = nb;
+  }
+
+  return nb;
+}
+
+//
+// Start an unordered, non-fetching atomic operation and return without
+// waiting for it.  The task waits for its operations when it ends or in
+// chpl_comm_atomic_unordered_task_fence().
+//
+static inline
+void do_amo_nb(c_nodeid_t node, void* object, amo_op_t op, amo_type_t type,
+               size_t size, const void* operand) {
+  amo_req_t req;
+  amo_nb_t* nb;
+
+  if (node == chpl_nodeID) {
+    do_amo(node, object, op, type, size, operand, NULL, NULL);
+    return;
+  }
+
+  nb = get_amo_nb();
+
+  req.obj = object;
+  req.result = NULL;
+  req.ack = &nb->done;
+  req.op = op;
+  req.type = type;
+  req.nb = true;
+  req.opnd1.u64 = 0;
+  memcpy(&req.opnd1, operand, size);
+  req.opnd2.u64 = 0;
+
+  nb->issued++;
+  atomic_fetch_add_uint_least64_t(&amo_nb_issued_all, 1);
+  GASNET_Safe(gasnet_AMRequestMedium0(node, DO_AMO, &req, sizeof(req)));
+}
+
+
+#define DEFN_CHPL_COMM_ATOMIC_WRITE(fnType, amoType, Type)              \
+  void chpl_comm_atomic_write_##fnType                                  \
+         (void* desired, c_nodeid_t node, void* object,                 \
+          memory_order order, int ln, int32_t fn) {                     \
+    do_amo(node, object, amo_write, amoType, sizeof(Type),              \
+           desired, NULL, NULL);                                        \
+  }
+
+#define DEFN_CHPL_COMM_ATOMIC_READ(fnType, amoType, Type)               \
+  void chpl_comm_atomic_read_##fnType                                   \
+         (void* result, c_nodeid_t node, void* object,                  \
+          memory_order order, int ln, int32_t fn) {                     \
+    do_amo(node, object, amo_read, amoType, sizeof(Type),               \
+           NULL, NULL, result);                                         \
+  }
+
+#define DEFN_CHPL_COMM_ATOMIC_XCHG(fnType, amoType, Type)               \
+  void chpl_comm_atomic_xchg_##fnType                                   \
+         (void* desired, c_nodeid_t node, void* object, void* result,   \
+          memory_order order, int ln, int32_t fn) {                     \
+    do_amo(node, object, amo_xchg, amoType, sizeof(Type),               \
+           desired, NULL, result);                                      \
+  }
+
+#define DEFN_CHPL_COMM_ATOMIC_CMPXCHG(fnType, amoType, Type)            \
+  void chpl_comm_atomic_cmpxchg_##fnType                                \
+         (void* expected, void* desired, c_nodeid_t node, void* object, \
+          chpl_bool32* result, memory_order order,                      \
+          int ln, int32_t fn) {                                         \
+    do_amo(node, object, amo_cmpxchg, amoType, sizeof(Type),            \
+           expected, desired, result);                                  \
+  }
+
+#define DEFN_CHPL_COMM_ATOMIC_BINARY(fnOp, amoOp, fnType, amoType, Type) \
+  void chpl_comm_atomic_##fnOp##_##fnType                               \
+         (void* operand, c_nodeid_t node, void* object,                 \
+          memory_order order, int ln, int32_t fn) {                     \
+    do_amo(node, object, amoOp, amoType, sizeof(Type),                  \
+           operand, NULL, NULL);                                        \
+  }                                                                     \
+                                                                        \
+  void chpl_comm_atomic_##fnOp##_unordered_##fnType                     \
+         (void* operand, c_nodeid_t node, void* object,                 \
+          int ln, int32_t fn) {                                         \
+    do_amo_nb(node, object, amoOp, amoType, sizeof(Type), operand);     \
+  }                                                                     \
+                                                                        \
+  void chpl_comm_atomic_fetch_##fnOp##_##fnType                         \
+         (void* operand, c_nodeid_t node, void* object, void* result,   \
+          memory_order order, int ln, int32_t fn) {                     \
+    do_amo(node, object, amoOp, amoType, sizeof(Type),                  \
+           operand, NULL, result);                                      \
+  }
+
+#define DEFN_CHPL_COMM_ATOMIC_ALL(fnType, amoType, Type)                \
+  DEFN_CHPL_COMM_ATOMIC_WRITE(fnType, amoType, Type)                    \
+  DEFN_CHPL_COMM_ATOMIC_READ(fnType, amoType, Type)                     \
+  DEFN_CHPL_COMM_ATOMIC_XCHG(fnType, amoType, Type)                     \
+  DEFN_CHPL_COMM_ATOMIC_CMPXCHG(fnType, amoType, Type)                  \
+  DEFN_CHPL_COMM_ATOMIC_BINARY(add, amo_add, fnType, amoType, Type)     \
+  DEFN_CHPL_COMM_ATOMIC_BINARY(sub, amo_sub, fnType, amoType, Type)
+
+#define DEFN_CHPL_COMM_ATOMIC_ALL_INT(fnType, amoType, Type)            \
+  DEFN_CHPL_COMM_ATOMIC_ALL(fnType, amoType, Type)                      \
+  DEFN_CHPL_COMM_ATOMIC_BINARY(and, amo_and, fnType, amoType, Type)     \
+  DEFN_CHPL_COMM_ATOMIC_BINARY(or, amo_or, fnType, amoType, Type)       \
+  DEFN_CHPL_COMM_ATOMIC_BINARY(xor, amo_xor, fnType, amoType, Type)
+
+DEFN_CHPL_COMM_ATOMIC_ALL_INT(int32, amo_int32, int32_t)
+DEFN_CHPL_COMM_ATOMIC_ALL_INT(int64, amo_int64, int64_t)
+DEFN_CHPL_COMM_ATOMIC_ALL_INT(uint32, amo_uint32, uint32_t)
+DEFN_CHPL_COMM_ATOMIC_ALL_INT(uint64, amo_uint64, uint64_t)
+DEFN_CHPL_COMM_ATOMIC_ALL(real32, amo_real32, _real32)
+DEFN_CHPL_COMM_ATOMIC_ALL(real64, amo_real64, _real64)
+
+
+#ifndef CHPL_COMM_YIELD_TASK_WHILE_POLLING
+#define AMO_NB_WAIT_UNTIL(cond) GASNET_BLOCKUNTIL(cond)
+#else
+#define AMO_NB_WAIT_UNTIL(cond)                                         \
+  do {                                                                  \
+    while (!(cond)) {                                                   \
+      (void) gasnet_AMPoll();                                           \
+      chpl_task_yield();                                                \
+    }                                                                   \
+  } while (0)
+#endif
+
+// Wait for all of the unordered atomics issued on this node.
+void chpl_comm_atomic_unordered_fence(void) {
+  AMO_NB_WAIT_UNTIL(atomic_load_uint_least64_t(&amo_nb_acked_all)
+                    == atomic_load_uint_least64_t(&amo_nb_issued_all));
+}
+
+// Wait for the unordered atomics issued by this task.
+void chpl_comm_atomic_unordered_task_fence(void) {
+  chpl_task_prvData_t* prv = chpl_task_getPrvData();
+  amo_nb_t* nb = (amo_nb_t*) prv->comm_data.amo_nb;
+
+  if (nb == NULL)
+    return;
+
+  AMO_NB_WAIT_UNTIL(atomic_load_uint_least32_t(&nb->done.count)
+                    == nb->issued);
+
+  prv->comm_data.amo_nb = NULL;
+  chpl_mem_free(nb, 0, 0);
+}
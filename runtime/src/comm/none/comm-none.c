@@ -20,6 +20,7 @@
 #include "chplrt.h"
 
 #include "chpl-comm.h"
+#include "chpl-comm-aggregate.h"
 #include "chpl-comm-strd-xfer.h"
 #include "chplexit.h"
 #include "error.h"
@@ -221,4 +222,14 @@ int chpl_comm_numPollingTasks(void) { return 0; }
 
 void chpl_comm_make_progress(void) { }
 
-void chpl_comm_task_end(void) { }
+void chpl_comm_task_end(void) {
+  chpl_comm_agg_task_flush();
+}
+
+void chpl_comm_agg_apply_on(c_nodeid_t node,
+                            chpl_comm_agg_entry_t* entries, size_t n,
+                            int ln, int32_t fn) {
+  assert(node==0);
+
+  chpl_comm_agg_apply(entries, n);
+}
@@ -26,6 +26,7 @@
 
 // #include "chpl-cache.h"
 #include "chpl-comm.h"
+#include "chpl-comm-aggregate.h"
 #include "chpl-comm-callbacks.h"
 #include "chpl-comm-callbacks-internal.h"
 #include "chpl-comm-diags.h"
@@ -1316,6 +1317,7 @@ typedef enum {
   am_opGet,                             // do an RMA GET
   am_opPut,                             // do an RMA PUT
   am_opAMO,                             // do an AMO
+  am_opAggApply,                        // apply aggregated updates
 } amOp_t;
 
 #ifdef CHPL_COMM_DEBUG
@@ -1328,6 +1330,7 @@ static void amRequestExecOn(c_nodeid_t, c_sublocid_t, chpl_fn_int_t,
 static void amRequestRMA(c_nodeid_t, amOp_t, void*, void*, size_t);
 static void amRequestAMO(c_nodeid_t, void*, const void*, const void*, void*,
                          int, enum fi_datatype, size_t);
+static void amRequestAggApply(c_nodeid_t, chpl_comm_agg_entry_t*, size_t);
 static void amRequestCommon(c_nodeid_t, chpl_comm_on_bundle_t*, size_t,
                             chpl_comm_amDone_t**);
 
@@ -1356,7 +1359,19 @@ void chpl_comm_make_progress(void) {
 }
 
 
-void chpl_comm_task_end(void) { }
+void chpl_comm_task_end(void) {
+  chpl_comm_agg_task_flush();
+}
+
+
+void chpl_comm_agg_apply_on(c_nodeid_t node,
+                            chpl_comm_agg_entry_t* entries, size_t n,
+                            int ln, int32_t fn) {
+  if (n == 0) {
+    return;
+  }
+  amRequestAggApply(node, entries, n);
+}
 
 
 void chpl_comm_execute_on(c_nodeid_t node, c_sublocid_t subloc,
@@ -1497,6 +1512,41 @@ void amRequestRMA(c_nodeid_t node, amOp_t op,
 }
 
 
+static inline
+void amRequestAggApply(c_nodeid_t node,
+                       chpl_comm_agg_entry_t* entries, size_t n) {
+  //
+  // The target GETs the entries from us, so they have to be in
+  // registered memory for the duration of the AM.
+  //
+  size_t size = n * sizeof(*entries);
+  chpl_comm_agg_entry_t* myEntries = entries;
+  if (mrGetLocalKey(NULL, myEntries, size) != 0) {
+    myEntries = allocBounceBuf(size);
+    DBG_PRINTF(DBG_AM, "AggApply entries BB: %p", myEntries);
+    CHK_TRUE(mrGetLocalKey(NULL, myEntries, size) == 0);
+    memcpy(myEntries, entries, size);
+  }
+
+  chpl_comm_on_bundle_t arg;
+  arg.comm.rma = (struct chpl_comm_bundleData_RMA_t)
+                   { .b = (struct chpl_comm_bundleData_base_t)
+                          { .op = am_opAggApply, .node = chpl_nodeID },
+                     .addr = NULL,
+                     .raddr = myEntries,
+                     .size = size,
+                     .pDone = NULL };
+  amRequestCommon(node, &arg,
+                  (offsetof(chpl_comm_on_bundle_t, comm)
+                   + sizeof(arg.comm.rma)),
+                  &arg.comm.rma.pDone);
+
+  if (myEntries != entries) {
+    freeBounceBuf(myEntries);
+  }
+}
+
+
 static inline
 void amRequestAMO(c_nodeid_t node, void* object,
                   const void* operand1, const void* operand2, void* result,
@@ -1657,6 +1707,7 @@ static inline void amWrapExecOnBody(void*);
 static void amHandleExecOnLrg(chpl_comm_on_bundle_t*);
 static void amWrapExecOnLrgBody(void*);
 static void amWrapGet(void*);
+static void amWrapAggApply(void*);
 static void amWrapPut(void*);
 static void amHandleAMO(chpl_comm_on_bundle_t*);
 static inline void amSendDone(struct chpl_comm_bundleData_base_t*,
@@ -1848,6 +1899,18 @@ void processRxAmReq(struct perTxCtxInfo_t* tcip) {
         amHandleAMO(req);
         break;
 
+      case am_opAggApply:
+        //
+        // Applying the entries can take a while and the entries have
+        // to be retrieved from the initiator first, so do it in a task
+        // rather than holding up the AM handler.
+        //
+        chpl_task_startMovedTask(FID_NONE, (chpl_fn_p) amWrapAggApply,
+                                 chpl_comm_on_bundle_task_bundle(req),
+                                 sizeof(*req), c_sublocid_any,
+                                 chpl_nullTaskID);
+        break;
+
       default:
         INTERNAL_ERROR_V("unexpected AM op %d", req->comm.b.op);
         break;
@@ -2005,6 +2068,27 @@ void amWrapPut(void* p) {
 }
 
 
+static
+void amWrapAggApply(void* p) {
+  chpl_comm_on_bundle_t* req = (chpl_comm_on_bundle_t*) p;
+  struct chpl_comm_bundleData_RMA_t* rma = &req->comm.rma;
+  DBG_PRINTF(DBG_AM | DBG_AMRECV,
+             "amWrapAggApply(seqId %d:%" PRIu64 "): <- %d:%p (%zd bytes)",
+             (int) rma->b.node, rma->b.seq,
+             (int) rma->b.node, rma->raddr, rma->size);
+
+  chpl_comm_agg_entry_t* entries;
+  CHPL_CALLOC_SZ(entries, 1, rma->size);
+  CHK_TRUE(mrGetKey(NULL, rma->b.node, rma->raddr, rma->size) == 0); // sanity
+  (void) ofi_get(entries, rma->b.node, rma->raddr, rma->size);
+
+  chpl_comm_agg_apply(entries, rma->size / sizeof(*entries));
+  CHPL_FREE(entries);
+
+  amSendDone(&rma->b, rma->pDone);
+}
+
+
 static
 void amHandleAMO(chpl_comm_on_bundle_t* req) {
   struct chpl_comm_bundleData_AMO_t* amo = &req->comm.amo;
@@ -3543,6 +3627,7 @@ const char* am_op2name(amOp_t op) {
   case am_opGet: return "opGet";
   case am_opPut: return "opPut";
   case am_opAMO: return "opAMO";
+  case am_opAggApply: return "opAggApply";
   }
   return "op???";
 }
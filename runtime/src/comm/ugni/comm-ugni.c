@@ -53,6 +53,7 @@
 #include "chplrt.h"
 #include "chpl-cache.h"
 #include "chpl-comm.h"
+#include "chpl-comm-aggregate.h"
 #include "chpl-comm-diags.h"
 #include "chpl-comm-callbacks.h"
 #include "chpl-comm-callbacks-internal.h"
@@ -972,10 +973,11 @@ typedef enum {
   fork_op_free,
   fork_op_amo,
   fork_op_shutdown,
+  fork_op_agg_apply,
   fork_op_num_ops
 } fork_op_t;
 
-#define FORK_OP_BITS 3
+#define FORK_OP_BITS 4
 
 typedef struct {
   unsigned char op: FORK_OP_BITS;    // operation
@@ -1497,6 +1499,7 @@ static void      rf_handler(gni_cq_entry_t*);
 static void      fork_call_wrapper_blocking(chpl_comm_on_bundle_t*);
 static void      fork_call_wrapper_large(fork_large_call_task_t*);
 static void      fork_get_wrapper(fork_xfer_task_t*);
+static void      fork_agg_apply_wrapper(fork_xfer_task_t*);
 static size_t    do_amo_on_cpu(fork_amo_cmd_t, void*, void*, void*, void*);
 static void      fork_amo_wrapper(fork_amo_info_t*);
 static void      release_req_buf(uint32_t, int, int);
@@ -1563,6 +1566,7 @@ static void      fork_put(void*, c_nodeid_t, void*, size_t);
 static void      fork_get(void*, c_nodeid_t, void*, size_t);
 static void      fork_free(c_nodeid_t, void*);
 static void      fork_amo(fork_t*, c_nodeid_t);
+static void      fork_agg_apply(c_nodeid_t, chpl_comm_agg_entry_t*, size_t);
 static void      fork_shutdown(c_nodeid_t);
 static void      do_fork_post(c_nodeid_t, chpl_bool,
                               uint64_t, fork_base_info_t* const, int*, int*);
@@ -1654,7 +1658,9 @@ static const char* fork_op_name(fork_op_t op)
                                  "put",
                                  "get",
                                  "free",
-                                 "amo" };
+                                 "amo",
+                                 "shutdown",
+                                 "agg_apply" };
   return ((int)op >= 0 && op < fork_op_num_ops) ? names[op] : "?op?";
 }
 
@@ -1747,6 +1753,15 @@ static char* sprintf_rf_req(int loc, void* f_in)
     }
     break;
 
+  case fork_op_agg_apply:
+    {
+      fork_xfer_info_t* px = (fork_xfer_info_t*) f;
+      snprintf(&buf[bufcnt], sizeof(buf) - bufcnt,
+               "<- %d:%p, %zd bytes",
+               loc, px->src, px->size);
+    }
+    break;
+
   case fork_op_free:
     {
       fork_free_info_t* fr = (fork_free_info_t*) f;
@@ -1973,10 +1988,21 @@ int chpl_comm_numPollingTasks(void)
 }
 
 void chpl_comm_task_end(void) {
+  chpl_comm_agg_task_flush();
   remote_get_buff_task_flush();
   nic_amo_nf_buff_task_flush();
 }
 
+void chpl_comm_agg_apply_on(c_nodeid_t node,
+                            chpl_comm_agg_entry_t* entries, size_t n,
+                            int ln, int32_t fn)
+{
+  if (n == 0)
+    return;
+
+  fork_agg_apply(node, entries, n);
+}
+
 void chpl_comm_post_task_init(void)
 {
   if (chpl_numNodes == 1)
@@ -4183,6 +4209,20 @@ void rf_handler(gni_cq_entry_t* ev)
     }
     break;
 
+  case fork_op_agg_apply:
+    DBG_P_LP(DBGF_RF, "forkFrom(%d) %s",
+             (int) req_li, sprintf_rf_req((int) req_li, f));
+
+    {
+      fork_xfer_task_t bundle = {.x = f->x};
+
+      release_req_buf(req_li, req_cdi, req_rbi);
+      chpl_task_startMovedTask(FID_NONE, (chpl_fn_p) fork_agg_apply_wrapper,
+                               &bundle.task, sizeof(fork_xfer_task_t),
+                               c_sublocid_any, chpl_nullTaskID);
+    }
+    break;
+
   case fork_op_free:
     DBG_P_LP(DBGF_RF, "forkFrom(%d) %s",
              (int) req_li, sprintf_rf_req(-1, f));
@@ -4301,6 +4341,25 @@ void fork_get_wrapper(fork_xfer_task_t* f)
   indicate_done(&f->x.b);
 }
 
+static
+void fork_agg_apply_wrapper(fork_xfer_task_t* f)
+{
+  //
+  // Retrieve the entries from the caller and apply them here.  We're
+  // in a task rather than the fork handler, so the GET may proxy if
+  // the caller's buffer isn't NIC-registered.
+  //
+  chpl_comm_agg_entry_t* entries;
+
+  entries = (chpl_comm_agg_entry_t*)
+            chpl_mem_alloc(f->x.size, CHPL_RT_MD_COMM_PER_LOC_INFO, 0, 0);
+  do_remote_get(entries, f->x.b.caller, f->x.src, f->x.size, may_proxy_true);
+  chpl_comm_agg_apply(entries, f->x.size / sizeof(*entries));
+  chpl_mem_free(entries, 0, 0);
+
+  indicate_done(&f->x.b);
+}
+
 
 static
 inline
@@ -7819,6 +7878,35 @@ void fork_get(void* addr, c_nodeid_t locale, void* raddr, size_t size)
 }
 
 
+static
+void fork_agg_apply(c_nodeid_t locale,
+                    chpl_comm_agg_entry_t* entries, size_t n)
+{
+  fork_base_info_t hdr = { .op       = fork_op_agg_apply,
+                           .caller   = chpl_nodeID,
+                           .rf_done  = NULL // set in do_fork_post
+                         };
+
+  fork_xfer_info_t req = { .b = hdr,
+                           .tgt = NULL,
+                           .src = entries,
+                           .size = n * sizeof(*entries) };
+
+  if (locale < 0 || locale >= chpl_numNodes)
+    CHPL_INTERNAL_ERROR("fork_agg_apply(): remote locale out of range");
+
+  DBG_SET_SEQ(req.b.seq);
+  DBG_P_LP(DBGF_RF, "forkTo(%d) %s",
+           (int) locale, sprintf_rf_req(locale, &req));
+
+  //
+  // Blocking, so the entries stay put until the target has retrieved
+  // and applied them.
+  //
+  do_fork_post(locale, true /*blocking*/, sizeof(req), &req.b, NULL, NULL);
+}
+
+
 static
 void fork_free(c_nodeid_t locale, void* p)
 {
@@ -22,6 +22,7 @@
 #define CHPL_RE2
 #endif
 
+#include <algorithm>
 #include <limits>
 #include <pthread.h>
 #include <stdlib.h>
@@ -42,6 +43,7 @@
 #undef printf
 
 #include "re2/re2.h"
+#include "re2/set.h"
 
 using namespace re2;
 
@@ -558,3 +560,181 @@ markerror:
 }
 
 
+
+
+struct re_set_t {
+  RE2::Set set;
+  int64_t size;
+  qbytes_refcnt_t ref_cnt;
+  re_set_t(const RE2::Options& options, RE2::Anchor anchor)
+    : set(options, anchor), size(0)
+  {
+    DO_INIT_REFCNT(this);
+  }
+};
+
+static
+void re_set_free(re_set_t* s)
+{
+  delete s;
+}
+
+// RE2::Set::Match reports its matches in a vector; keep one per thread
+// so that matching does not allocate a new one each time.
+static
+int64_t re_set_match_text(re_set_t* s, const StringPiece& text, int64_t* matched, int64_t nmatched)
+{
+  static thread_local std::vector<int> found;
+
+  if( ! s->set.Match(text, &found) ) return 0;
+
+  std::sort(found.begin(), found.end());
+  for( size_t i = 0; i < found.size() && (int64_t) i < nmatched; i++ ) {
+    matched[i] = found[i];
+  }
+  return found.size();
+}
+
+// The set returned in 'set' must be released by the caller.
+void qio_regexp_set_create(const qio_regexp_options_t* options, int anchor, qio_regexp_set_t* set)
+{
+  RE2::Options opts;
+  RE2::Anchor ranchor = RE2::UNANCHORED;
+
+  qio_re_options_to_re2_options(options, &opts);
+  // Errors are reported to the caller of qio_regexp_set_add instead.
+  opts.set_log_errors(false);
+
+  if( anchor == QIO_REGEXP_ANCHOR_UNANCHORED ) ranchor = RE2::UNANCHORED;
+  else if( anchor == QIO_REGEXP_ANCHOR_START ) ranchor = RE2::ANCHOR_START;
+  else if( anchor == QIO_REGEXP_ANCHOR_BOTH ) ranchor = RE2::ANCHOR_BOTH;
+
+  set->set = (void*) new re_set_t(opts, ranchor);
+}
+
+int64_t qio_regexp_set_add(qio_regexp_set_t* set, const char* str, int64_t str_len, const char** err_str)
+{
+  re_set_t* s = (re_set_t*) set->set;
+  StringPiece strp(str, str_len);
+  std::string error;
+  int ret;
+
+  *err_str = NULL;
+  ret = s->set.Add(strp, &error);
+  if( ret < 0 ) {
+    *err_str = qio_strdup(error.c_str());
+    return -1;
+  }
+  s->size++;
+  return ret;
+}
+
+qio_bool qio_regexp_set_compile(qio_regexp_set_t* set)
+{
+  re_set_t* s = (re_set_t*) set->set;
+  return s->set.Compile();
+}
+
+void qio_regexp_set_retain(const qio_regexp_set_t* set)
+{
+  re_set_t* s = (re_set_t*) set->set;
+  if( s ) DO_RETAIN(s);
+}
+
+void qio_regexp_set_release(qio_regexp_set_t* set)
+{
+  re_set_t* s = (re_set_t*) set->set;
+  if( s ) DO_RELEASE(s, re_set_free);
+  set->set = NULL;
+}
+
+int64_t qio_regexp_set_size(const qio_regexp_set_t* set)
+{
+  re_set_t* s = (re_set_t*) set->set;
+  return s->size;
+}
+
+int64_t qio_regexp_set_match(const qio_regexp_set_t* set, const char* text, int64_t text_len, int64_t* matched, int64_t nmatched)
+{
+  StringPiece textp(text, text_len);
+  return re_set_match_text((re_set_t*) set->set, textp, matched, nmatched);
+}
+
+qioerr qio_regexp_set_channel_match_line(const qio_regexp_set_t* set, const int threadsafe, struct qio_channel_s* ch, qio_regexp_string_piece_t* line, int64_t* matched, int64_t nmatched, int64_t* nfound)
+{
+  re_set_t* s = (re_set_t*) set->set;
+  // Only used for lines that do not fit in the channel's buffer.
+  static thread_local std::string spill;
+  qioerr err = 0;
+  int64_t start;
+  bool started = false;
+  bool in_place = false;
+  bool done = false;
+
+  *nfound = 0;
+  line->offset = -1;
+  line->len = 0;
+
+  if( threadsafe ) {
+    err = qio_lock(&ch->lock);
+    if( err ) {
+      return err;
+    }
+  }
+
+  start = qio_channel_offset_unlocked(ch);
+  spill.clear();
+
+  while( err == 0 && ! done ) {
+    if( qio_space_in_ptr_diff(1, ch->cached_end, ch->cached_cur) ) {
+      size_t len = qio_ptr_diff(ch->cached_end, ch->cached_cur);
+      const char* cur = (const char*) ch->cached_cur;
+      const char* found = (const char*) memchr(cur, '\n', len);
+      started = true;
+      if( found != NULL && spill.empty() ) {
+        // The whole line is in the buffer, so match it in place.
+        *nfound = re_set_match_text(s, StringPiece(cur, found - cur),
+                                    matched, nmatched);
+        line->len = found - cur;
+        ch->cached_cur = qio_ptr_add(ch->cached_cur, line->len + 1);
+        in_place = true;
+        done = true;
+      } else if( found != NULL ) {
+        spill.append(cur, found - cur);
+        ch->cached_cur = qio_ptr_add(ch->cached_cur, (found - cur) + 1);
+        done = true;
+      } else {
+        spill.append(cur, len);
+        ch->cached_cur = ch->cached_end;
+      }
+    } else {
+      ssize_t amt_read;
+      uint8_t tmp;
+      err = _qio_slow_read(ch, &tmp, 1, &amt_read);
+      if( err == 0 && amt_read != 1 ) err = QIO_ESHORT;
+      if( err == 0 ) {
+        started = true;
+        if( tmp == '\n' ) done = true;
+        else spill.push_back((char) tmp);
+      } else if( qio_err_to_int(err) == EEOF && started ) {
+        // A last line without a trailing newline.
+        err = 0;
+        done = true;
+      }
+    }
+  }
+
+  if( err == 0 ) {
+    line->offset = start;
+    if( ! in_place ) {
+      *nfound = re_set_match_text(s, StringPiece(spill), matched, nmatched);
+      line->len = spill.size();
+    }
+  }
+
+  if( threadsafe ) {
+    qio_unlock(&ch->lock);
+  }
+
+  return err;
+}
@@ -0,0 +1,45 @@
+use ConcurrentMap;
+
+var m = new owned ConcurrentMap(int, string, segments=4);
+
+writeln(m.isEmpty());
+for i in 1..100 do
+  m.add(i, i:string);
+writeln(m.size);
+
+writeln(m.add(5, "five"), " ", m[5]);
+writeln(m.set(5, "five"), " ", m[5]);
+writeln(m.set(500, "x"), " ", m.size);
+
+writeln(m.contains(42), " ", m.contains(-1));
+writeln(m.get(42), " ", m.get(-1));
+
+for i in 1..100 by 2 do
+  m.remove(i);
+writeln(m.remove(1), " ", m.remove(2), " ", m.size);
+
+// Deleted slots must not hide keys added after them
+for i in 1..100 by 2 do
+  m.add(i, "again");
+writeln(m.size, " ", m[1], " ", m[4]);
+
+var total = 0;
+for (k, v) in m do
+  total += k;
+writeln(total);
+
+var D = m.keysDomain();
+writeln(D.size, " ", D.contains(500));
+
+m.removeAll();
+writeln(m.size, " ", m.contains(4));
+
+var words = new owned ConcurrentMap(string, int);
+for w in ["a", "b", "a", "c", "a", "b"] do
+  words.addOrCombine(w, 1, new SumCombiner());
+writeln(words["a"], " ", words["b"], " ", words["c"]);
+
+var mx = new owned ConcurrentMap(string, int);
+for (w, x) in zip(["a", "b", "a", "b"], [3, 1, 2, 5]) do
+  mx.addOrCombine(w, x, new MaxCombiner());
+writeln(mx["a"], " ", mx["b"]);
@@ -0,0 +1,32 @@
+use ConcurrentMap;
+
+config const n = 100000;
+
+var m = new owned ConcurrentMap(int, int);
+
+// Every key is added by two tasks
+forall i in 0..#2*n do
+  m.addOrCombine(i % n, 1, new SumCombiner());
+
+writeln(m.size == n);
+writeln(&& reduce [i in 0..#n] m[i] == 2);
+
+forall i in 0..#n by 2 do
+  m.remove(i);
+writeln(m.size == n / 2);
+writeln(+ reduce m.values() == n);
+
+var keys: [0..#n] int = 0..#n;
+var vals: [0..#n] int = 10;
+var b = new owned ConcurrentMap(int, int);
+b.addAll(keys, vals);
+b.addAll(keys, vals);
+writeln(b.size == n, " ", + reduce b.values() == 10 * n);
+
+b.addOrCombineAll(keys, vals, new SumCombiner());
+writeln(+ reduce b.values() == 20 * n);
+
+var s = new owned ConcurrentMap(string, int);
+forall i in 0..#n with (ref s) do
+  s.add(i:string, i);
+writeln(s.size == n, " ", s["1234"]);
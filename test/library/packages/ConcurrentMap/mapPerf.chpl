@@ -0,0 +1,68 @@
+/*
+   Compares adding keys from several tasks at once to a ConcurrentMap with
+   adding them to a parSafe associative domain.
+ */
+use ConcurrentMap;
+use Random;
+use Time;
+
+config const n = 100000;
+config const maxTasks = 4;
+config const printTiming = false;
+
+var keys: [0..#n] int;
+fillRandom(keys, seed=17);
+
+proc report(what, nTasks, t: Timer) {
+  if printTiming then
+    writeln(what, " ", nTasks, " tasks (M adds/s): ", n / t.elapsed() / 1e6);
+}
+
+// The indices of keys that task t of nTasks adds
+proc taskRange(t, nTasks) {
+  return (n * t) / nTasks..(n * (t+1)) / nTasks - 1;
+}
+
+for nTasks in (if printTiming then 1..maxTasks else maxTasks..maxTasks) {
+  var t: Timer;
+
+  var m = new owned ConcurrentMap(int, int);
+  t.start();
+  coforall tid in 0..#nTasks do
+    for i in taskRange(tid, nTasks) do
+      m.add(keys[i], i);
+  t.stop();
+  report("ConcurrentMap add", nTasks, t);
+
+  var D: domain(int, parSafe=true);
+  t.clear();
+  t.start();
+  coforall tid in 0..#nTasks with (ref D) do
+    for i in taskRange(tid, nTasks) do
+      D += keys[i];
+  t.stop();
+  report("parSafe domain add", nTasks, t);
+
+  if m.size != D.size then
+    writeln(nTasks, " tasks: sizes differ");
+}
+
+// addAll uses up to here.maxTaskPar tasks
+{
+  var t: Timer;
+  var vals: [0..#n] int;
+  var b = new owned ConcurrentMap(int, int);
+  t.start();
+  b.addAll(keys, vals);
+  t.stop();
+  if printTiming then
+    writeln("ConcurrentMap addAll (M adds/s): ", n / t.elapsed() / 1e6);
+
+  var U: domain(int);
+  for k in keys do
+    U += k;
+  if b.size != U.size then
+    writeln("addAll: wrong size");
+}
+
+writeln("done");
@@ -0,0 +1,48 @@
+use DistributedMap;
+use BlockDist;
+
+config const n = 10000;
+
+var m = new DistMap(int, int);
+
+for i in 1..100 do
+  m.add(i, i * 10);
+writeln(m.size, " ", m[7], " ", m.contains(101));
+writeln(m.add(7, 0), " ", m.set(7, 1), " ", m[7]);
+writeln(m.remove(7), " ", m.remove(7), " ", m.size);
+m.addOrCombine(8, 5, new SumCombiner());
+writeln(m[8]);
+
+// The keys are spread over every locale
+var onLocs: [LocaleSpace] bool;
+for (k, v) in m do
+  onLocs[m.localeFor(k).id] = true;
+writeln(&& reduce onLocs || numLocales > 100);
+
+var total = 0;
+forall (k, v) in m with (+ reduce total) do
+  total += v;
+writeln(total);
+
+m.removeAll();
+writeln(m.size, " ", m.isEmpty());
+
+// Count how often each key occurs, with aggregated updates
+const D = {0..#n} dmapped Block({0..#n});
+var keys: [D] int = [i in D] i % 1000;
+
+forall k in keys with (var agg = m.aggregator(new SumCombiner())) do
+  agg.addOrCombine(k, 1);
+
+writeln(m.size, " ", m[0], " ", m[999]);
+
+// Look up keys in bulk, some of which are missing
+var lookups: [D] int = [i in D] i - n / 2;
+var (found, vals) = m.getAll(lookups);
+writeln(+ reduce found, " ", + reduce vals);
+
+// Aggregated updates without a combiner keep the first value
+var f = new DistMap(string, int);
+forall i in D with (var agg = f.aggregator()) do
+  agg.add((i % 10):string, 1);
+writeln(f.size, " ", f["3"]);
@@ -0,0 +1,39 @@
+// Check the operations whose work is split up by locale when the keys are
+// not stored by a Block distribution or are used away from the locale that
+// created the map.
+use DistributedMap;
+use CyclicDist;
+
+config const n = 100;
+
+var m = new DistMap(int, int);
+for i in 1..n do
+  m.add(i, i);
+
+// getAll over a Cyclic array, whose local indices are strided
+const D = {1..n} dmapped Cyclic(startIdx=1);
+var keys: [D] int = [i in D] i;
+var (found, vals) = m.getAll(keys);
+writeln(+ reduce found, " ", + reduce vals);
+
+// The same with more than one task per locale
+const bigN = 5 * distributedMapBufferSize * numLocales;
+const BigD = {1..bigN} dmapped Cyclic(startIdx=1);
+var bigKeys: [BigD] int = [i in BigD] i % (2 * n);
+var (bigFound, bigVals) = m.getAll(bigKeys);
+writeln(+ reduce bigFound == + reduce [k in bigKeys] (k >= 1 && k <= n),
+        " ", + reduce bigVals == + reduce [k in bigKeys] (if k <= n then k else 0));
+
+// An aggregator used on another locale than the one that created it
+var a = new DistMap(int, int);
+{
+  var agg = a.aggregator();
+  on Locales[numLocales-1] {
+    for i in 1..n do
+      agg.add(i, i);
+  }
+}
+var nFound = 0;
+for i in 1..n do
+  if a.contains(i) then nFound += 1;
+writeln(a.size, " ", nFound);
@@ -0,0 +1,45 @@
+/*
+   Builds a table of how often each key occurs in a Block-distributed
+   array, updating a DistMap either with one on-statement per key or
+   through aggregators.
+ */
+use DistributedMap;
+use BlockDist;
+use Random;
+use Time;
+
+config const n = 100000;
+config const numKeys = 10000;
+config const printTiming = false;
+
+const D = {0..#n} dmapped Block({0..#n});
+var keys: [D] int;
+fillRandom(keys, seed=5);
+keys = abs(keys) % numKeys;
+
+var t: Timer;
+
+var direct = new DistMap(int, int);
+t.start();
+forall k in keys do
+  direct.addOrCombine(k, 1, new SumCombiner());
+t.stop();
+if printTiming then
+  writeln("direct (M updates/s): ", n / t.elapsed() / 1e6);
+
+var aggregated = new DistMap(int, int);
+t.clear();
+t.start();
+forall k in keys with (var agg = aggregated.aggregator(new SumCombiner())) do
+  agg.addOrCombine(k, 1);
+t.stop();
+if printTiming then
+  writeln("aggregated (M updates/s): ", n / t.elapsed() / 1e6);
+
+var total = 0;
+forall (k, v) in aggregated with (+ reduce total) {
+  total += v;
+  if direct[k] != v then
+    writeln("count for ", k, " differs");
+}
+writeln(total == n, " ", direct.size == aggregated.size);
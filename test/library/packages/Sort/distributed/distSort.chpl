@@ -0,0 +1,43 @@
+/*
+   Sort random keys in a Block or Cyclic array with sort(), which uses a
+   distributed sample sort when the array spans several locales.
+
+   Run with --n=1000000000 --printTiming=true on several locales to measure
+   the sort rate on 10**9 keys.
+ */
+
+use BlockDist, CyclicDist, Random, Sort, Time;
+
+config const n = 100000;
+config const useCyclic = false;
+config const printTiming = false;
+config const seed = 314159;
+
+proc main() {
+  const Space = {1..n};
+
+  if useCyclic then
+    sortKeys(Space dmapped Cyclic(startIdx=Space.low));
+  else
+    sortKeys(Space dmapped Block(boundingBox=Space));
+}
+
+proc sortKeys(D) {
+  var A: [D] int;
+  var t: Timer;
+
+  fillRandom(A, seed=seed);
+  const sum = + reduce A;
+
+  t.start();
+  sort(A);
+  t.stop();
+
+  writeln("sorted: ", isSorted(A));
+  writeln("same elements: ", sum == + reduce A);
+
+  if printTiming {
+    writeln("Time: ", t.elapsed());
+    writeln("MB/s: ", (n * numBytes(int)) / t.elapsed() / 1e6);
+  }
+}
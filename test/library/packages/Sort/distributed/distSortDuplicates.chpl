@@ -0,0 +1,46 @@
+// Distributed sort of arrays with many equal keys.  The equal keys must be
+// spread over all of the locales rather than all sent to one of them, so
+// count the comparisons each locale makes.
+
+use BlockDist, CyclicDist, Sort;
+
+config const n = 20000;
+
+const LocSpace = LocaleSpace dmapped Block(LocaleSpace);
+var compares: [LocSpace] int;
+
+record CountingComparator {
+  proc compare(a, b) {
+    compares.localAccess[here.id] += 1;
+    return a - b;
+  }
+}
+
+proc check(A, desc) {
+  const sum = + reduce A;
+  compares = 0;
+
+  sort(A, new CountingComparator());
+
+  const counts: [LocaleSpace] int = compares;
+  writeln(desc, ": sorted ", isSorted(A), ", same elements ", sum == + reduce A,
+          ", balanced ", max reduce counts <= 2 * (min reduce counts));
+}
+
+proc main() {
+  const Space = {1..n};
+  const BlockSpace = Space dmapped Block(boundingBox=Space);
+  const CyclicSpace = Space dmapped Cyclic(startIdx=1);
+
+  var A: [BlockSpace] int = 42;
+  check(A, "Block, all equal");
+
+  var B: [CyclicSpace] int = 42;
+  check(B, "Cyclic, all equal");
+
+  var C: [BlockSpace] int = [i in Space] (i * 7919) % 3;
+  check(C, "Block, three keys");
+
+  var D: [CyclicSpace] int = [i in Space] (i * 7919) % 3;
+  check(D, "Cyclic, three keys");
+}
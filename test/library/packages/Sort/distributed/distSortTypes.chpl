@@ -0,0 +1,44 @@
+// Distributed sort with other element types, comparators, and arrays
+// whose elements are not spread evenly across the locales.
+
+use BlockDist, CyclicDist, Sort;
+
+config const n = 1000;
+
+record Rev {
+  proc compare(a, b) { return b - a; }
+}
+
+proc check(A, comparator) {
+  sort(A, comparator);
+  writeln(isSorted(A, comparator));
+}
+
+proc main() {
+  const Space = {1..n};
+  const BlockSpace = Space dmapped Block(boundingBox=Space);
+  const CyclicSpace = Space dmapped Cyclic(startIdx=1);
+
+  // Many duplicate keys
+  var A: [BlockSpace] int = [i in Space] i % 7;
+  check(A, defaultComparator);
+
+  // A comparator with only a compare method
+  var B: [CyclicSpace] int = [i in Space] (i * 7919) % n;
+  check(B, new Rev());
+
+  // Strings
+  var C: [BlockSpace] string = [i in Space] ((i * 31) % n):string;
+  check(C, defaultComparator);
+
+  // Reverse sort of reals
+  var D: [CyclicSpace] real = [i in Space] ((i * 13) % n) / 3.0;
+  check(D, reverseComparator);
+
+  // The bounding box only covers part of the array, so the last locale
+  // holds most of the elements
+  const Skewed = Space dmapped Block(boundingBox={1..n/10});
+  var E: [Skewed] int = [i in Space] n - i;
+  check(E, defaultComparator);
+  writeln(E[1], " ", E[n]);
+}
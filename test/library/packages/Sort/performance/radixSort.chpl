@@ -0,0 +1,71 @@
+/*
+   Compares the radix sorts in the Sort module:
+
+     serial   - MSB radix sort moving elements into bins with one task
+     parallel - MSB radix sort moving elements into bins in parallel
+     lsb      - LSB radix sort
+
+   With --printTiming, each is run with 1..maxTasks tasks and the sorting
+   rate is reported in MB/s.
+ */
+use Sort;
+use Random;
+use Time;
+
+config const n = 100000;
+config const maxTasks = 4;
+config const printTiming = false;
+config const seed = 31;
+
+proc main() {
+  testType(int);
+  testType(uint(32));
+  testType(real);
+}
+
+proc testType(type T) {
+  var Input: [1..n] T;
+  fillRandom(Input, seed=seed);
+
+  var Expect = Input;
+  quickSort(Expect);
+
+  for alg in ["serial", "parallel", "lsb"] {
+    for nTasks in (if printTiming then 1..maxTasks else maxTasks..maxTasks) {
+      var A = Input;
+      var t: Timer;
+      t.start();
+      runSort(A, alg, nTasks);
+      t.stop();
+
+      if printTiming {
+        const mbs = n * numBytes(T) / t.elapsed() / (1024 * 1024);
+        writeln(T:string, " ", alg, " ", nTasks, " tasks MB/s: ", mbs);
+      }
+      if || reduce (A != Expect) then
+        writeln(T:string, " ", alg, " ", nTasks, " tasks: incorrect");
+    }
+  }
+
+  writeln(T:string, " done");
+}
+
+proc runSort(A, alg, nTasks) {
+  // minForTask is lowered so that small tests still use every task
+  select alg {
+    when "serial" do
+      msbRadixSort(A, settings=new MSBRadixSortSettings(
+                                 minForTask=64,
+                                 minForParallelShuffle=max(int),
+                                 maxTasks=nTasks));
+    when "parallel" do
+      msbRadixSort(A, settings=new MSBRadixSortSettings(
+                                 minForTask=64,
+                                 minForParallelShuffle=4096,
+                                 maxTasks=nTasks));
+    when "lsb" do
+      lsbRadixSort(A, settings=new MSBRadixSortSettings(
+                                 minForTask=64,
+                                 maxTasks=nTasks));
+  }
+}
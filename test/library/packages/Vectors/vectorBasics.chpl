@@ -0,0 +1,42 @@
+use Vectors;
+
+var v: vector(int);
+writeln(v.size, " ", v.isEmpty(), " ", v.capacity);
+
+for i in 1..20 do
+  v.append(i);
+writeln(v.size, " ", v.capacity);
+writeln(v);
+
+v.append([100, 200, 300]);
+writeln(v.first(), " ", v.last(), " ", v[20]);
+
+v[0] = -1;
+writeln(v.pop(), " ", v.size);
+
+var w = v;
+w.append(v);
+w[1] = 42;
+writeln(v.size, " ", w.size, " ", v[1], " ", w[1]);
+
+w = v;
+writeln(w.size, " ", w[1]);
+
+var A = v.toArray();
+writeln(A.domain, " ", + reduce A);
+
+v.clear();
+writeln(v.size, " ", v.isEmpty(), " ", v.capacity);
+
+v.reserve(1000);
+writeln(v.capacity);
+v.shrinkToFit();
+writeln(v.capacity);
+
+var s = new vector(string, capacity=2);
+s.push_back("a");
+s.push_back("bb");
+s.push_back("ccc");
+for x in s do
+  x += "!";
+writeln(s, " ", s.capacity);
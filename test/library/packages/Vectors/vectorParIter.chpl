@@ -0,0 +1,20 @@
+use Vectors;
+
+config const n = 10000;
+
+var v = new vector(int);
+var B: [1..n] int = 1..n;
+v.append(B);
+
+forall x in v do
+  x *= 2;
+writeln(+ reduce v == n * (n + 1));
+
+var A: [0..#n] int;
+forall (a, x) in zip(A, v) do
+  a = x;
+writeln(&& reduce (A == [i in 0..#n] 2 * (i + 1)));
+
+forall (x, i) in zip(v, 0..) do
+  x = i;
+writeln(&& reduce [i in v.indices] v[i] == i);
@@ -0,0 +1,21 @@
+use Vectors;
+
+config const nTasks = 4, perTask = 10000;
+
+var v = new vector(int, parSafe=true);
+
+coforall t in 0..#nTasks with (ref v) do
+  for i in 0..#perTask do
+    v.append(t * perTask + i);
+
+writeln(v.size == nTasks * perTask);
+
+var seen: [0..#nTasks*perTask] bool;
+for x in v do
+  seen[x] = true;
+writeln(&& reduce seen);
+
+coforall t in 0..#nTasks with (ref v) do
+  for i in 0..#perTask/2 do
+    v.pop();
+writeln(v.size == nTasks * perTask / 2);
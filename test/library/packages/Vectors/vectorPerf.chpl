@@ -0,0 +1,67 @@
+/*
+   Compares appending to and iterating over a vector with a LinkedList.
+ */
+use Vectors;
+use LinkedLists;
+use Time;
+
+config const n = 100000;
+config const printTiming = false;
+
+proc report(what, t: Timer) {
+  if printTiming then
+    writeln(what, " (M elements/s): ", n / t.elapsed() / 1e6);
+}
+
+proc testLinkedList() {
+  var l: LinkedList(int);
+  var t: Timer;
+
+  t.start();
+  for i in 1..n do
+    l.append(i);
+  t.stop();
+  report("LinkedList append", t);
+
+  t.clear();
+  t.start();
+  var sum = 0;
+  for x in l do
+    sum += x;
+  t.stop();
+  report("LinkedList iterate", t);
+
+  l.destroy();
+  return sum;
+}
+
+proc testVector() {
+  var v: vector(int);
+  var t: Timer;
+
+  t.start();
+  for i in 1..n do
+    v.append(i);
+  t.stop();
+  report("vector append", t);
+
+  t.clear();
+  t.start();
+  var sum = 0;
+  for x in v do
+    sum += x;
+  t.stop();
+  report("vector iterate", t);
+
+  t.clear();
+  t.start();
+  const parSum = + reduce v;
+  t.stop();
+  report("vector parallel iterate", t);
+
+  return if sum == parSum then sum else -1;
+}
+
+const expect = n * (n + 1) / 2;
+writeln(testLinkedList() == expect);
+writeln(testVector() == expect);
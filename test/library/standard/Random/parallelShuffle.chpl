@@ -0,0 +1,55 @@
+// Large arrays are shuffled in parallel. Check that the result is a
+// uniform permutation that only depends on the seed.
+use Random, BlockDist;
+
+config const n = 100000;
+config const trials = 4;
+
+proc check(param algorithm) {
+  const Space = {1..n};
+  var A: [Space dmapped Block(Space)] int;
+  var L: [Space] int;
+  permutation(A, seed=5, algorithm=algorithm);
+  permutation(L, seed=5, algorithm=algorithm);
+  assert(&& reduce (A == L));
+
+  var counts: [Space] int;
+  for a in A do counts[a] += 1;
+  assert(&& reduce (counts == 1));
+
+  // The same stream position gives the same shuffle, distributed or not
+  forall (a, i) in zip(A, Space) do a = i * 10;
+  forall (l, i) in zip(L, Space) do l = i * 10;
+  shuffle(A, seed=9, algorithm=algorithm);
+  shuffle(L, seed=9, algorithm=algorithm);
+  assert(&& reduce (A == L));
+  assert(+ reduce A == 10 * (+ reduce Space));
+
+  // Strided arrays
+  var S: [1..2*n by 2] int = 1..2*n by 2;
+  shuffle(S, seed=3, algorithm=algorithm);
+  assert(+ reduce S == + reduce (1..2*n by 2));
+  assert(!(&& reduce (S == (1..2*n by 2))));
+
+  // Where elements end up: split the array into 16 parts and count how
+  // many elements move from each part to each other part.
+  param parts = 16;
+  var moves: [0..#parts, 0..#parts] int;
+  var rs = makeRandomStream(int, seed=17, parSafe=false, algorithm=algorithm);
+  var P: [0..#n] int;
+  for 1..trials {
+    rs.permutation(P);
+    for (p, i) in zip(P, 0..) do
+      moves[p * parts / n, i * parts / n] += 1;
+  }
+  const expected = trials * n / (parts * parts): real;
+  const chisq = + reduce ((moves - expected) ** 2 / expected);
+  // 225 degrees of freedom: 99.9% of values are below 300
+  if chisq > 300 then
+    writeln(algorithm, ": chi-squared too large: ", chisq);
+
+  writeln(algorithm, ": OK");
+}
+
+check(RNG.PCG);
+check(RNG.Philox);
@@ -0,0 +1,29 @@
+use Random, BlockDist, Time;
+
+config const timing = true;
+config const n = 10000000;
+config const seed = 27;
+
+const Space = {1..n};
+var L: [Space] int;
+var B: [Space dmapped Block(Space)] int;
+
+proc run(ref A, param algorithm, name: string) {
+  forall (a, i) in zip(A, A.domain) do a = i;
+  var t: Timer;
+  t.start();
+  shuffle(A, seed, algorithm=algorithm);
+  t.stop();
+  if timing then writeln(name, ": ", t.elapsed());
+  return + reduce A;
+}
+
+const expect = + reduce Space;
+var ok = true;
+ok &&= run(L, RNG.PCG, "pcg local") == expect;
+ok &&= run(L, RNG.Philox, "philox local") == expect;
+ok &&= run(B, RNG.PCG, "pcg block") == expect;
+ok &&= run(B, RNG.Philox, "philox block") == expect;
+ok &&= && reduce (L == B);
+
+writeln("verify: ", if ok then "SUCCESS" else "FAILURE");
@@ -0,0 +1,35 @@
+use Random, BlockDist, Time;
+
+config const timing = true;
+config const n = 10000000;
+config const seed = 27;
+
+const Space = {1..n};
+const D = Space dmapped Block(Space);
+var A: [D] real;
+
+proc run(param algorithm, name: string) {
+  var t: Timer;
+  t.start();
+  fillRandom(A, seed, algorithm=algorithm);
+  t.stop();
+  if timing then writeln(name, ": ", t.elapsed());
+  return + reduce A;
+}
+
+run(RNG.PCG, "pcg");
+run(RNG.NPB, "npb");
+const sum1 = run(RNG.Philox, "philox");
+
+// Getting values one at a time from many tasks
+var rs = makeRandomStream(real, seed, algorithm=RNG.Philox);
+var t: Timer;
+t.start();
+forall a in A do
+  a = rs.getNext();
+t.stop();
+if timing then writeln("philox getNext: ", t.elapsed());
+
+// Both ways consumed the same values, just not in the same order
+const sum2 = + reduce A;
+writeln("verify: ", if abs(sum1 - sum2) < 1e-6 * n then "SUCCESS" else "FAILURE");
@@ -0,0 +1,123 @@
+use Random, BlockDist;
+
+config const n = 10000;
+
+// Known-answer tests from the Random123 distribution (kat_vectors)
+assert(philox4x32_10((0:uint(32), 0:uint(32), 0:uint(32), 0:uint(32)),
+                     (0:uint(32), 0:uint(32))) ==
+       (0x6627e8d5:uint(32), 0xe169c58d:uint(32),
+        0xbc57ac4c:uint(32), 0x9b00dbd8:uint(32)));
+assert(philox4x32_10((0xffffffff:uint(32), 0xffffffff:uint(32),
+                      0xffffffff:uint(32), 0xffffffff:uint(32)),
+                     (0xffffffff:uint(32), 0xffffffff:uint(32))) ==
+       (0x408f276d:uint(32), 0x41c83b0e:uint(32),
+        0xa20bc7c6:uint(32), 0x6d5451fd:uint(32)));
+assert(philox4x32_10((0x243f6a88:uint(32), 0x85a308d3:uint(32),
+                      0x13198a2e:uint(32), 0x03707344:uint(32)),
+                     (0xa4093822:uint(32), 0x299f31d0:uint(32))) ==
+       (0xd16cfe09:uint(32), 0x94fdcceb:uint(32),
+        0x5001e420:uint(32), 0x24126ea1:uint(32)));
+
+// Pin down the stream itself
+{
+  var rs = makeRandomStream(uint, seed=42, algorithm=RNG.Philox);
+  for i in 1..3 do
+    writef("%016xu\n", rs.getNext());
+}
+
+// Every way of drawing values gives the same sequence
+proc check(type t) {
+  const seed = 314159;
+  var expect: [1..n] t;
+  {
+    var rs = new owned PhiloxRandomStream(t, seed=seed, parSafe=false);
+    for i in 1..n do
+      expect[i] = rs.getNext();
+  }
+
+  var rs = new owned PhiloxRandomStream(t, seed=seed);
+  for i in 1..n by 7 do
+    assert(rs.getNth(i) == expect[i]);
+
+  const Space = {1..n};
+  var B: [Space dmapped Block(Space)] t;
+  rs.skipToNth(1);
+  rs.fillRandom(B);
+  assert(&& reduce (B == expect));
+  assert(rs.getNext() == (new owned PhiloxRandomStream(t, seed=seed)).getNth(n+1));
+
+  var L: [1..n] t;
+  fillRandom(L, seed, algorithm=RNG.Philox);
+  assert(&& reduce (L == expect));
+
+  // A strided 2-D array is filled in index order
+  var S: [1..2*n by 2, 1..1] t;
+  fillRandom(S, seed, algorithm=RNG.Philox);
+  assert(&& reduce [i in 1..n] S[2*i-1, 1] == expect[i]);
+
+  rs.skipToNth(1);
+  forall (x, e) in zip(rs.iterate(Space), expect) do
+    assert(x == e);
+  rs.skipToNth(1);
+  forall (b, x) in zip(B, rs.iterate(Space)) do
+    assert(b == x);
+  rs.skipToNth(1);
+  for (x, e) in zip(rs.iterate(Space), expect) do
+    assert(x == e);
+
+  writeln(t:string, ": OK");
+}
+
+check(bool);
+check(int(8));
+check(uint(16));
+check(int(32));
+check(uint(32));
+check(int);
+check(uint);
+check(real(32));
+check(real);
+check(imag);
+check(complex(64));
+check(complex);
+
+// Bounded values stay in range and cover it
+{
+  var rs = new owned PhiloxRandomStream(int, seed=7);
+  var seen: [-3..3] int;
+  for 1..n {
+    const x = rs.getNext(-3, 3);
+    seen[x] += 1;
+  }
+  assert(&& reduce (seen > 0));
+
+  var rr = new owned PhiloxRandomStream(real, seed=7);
+  for 1..n {
+    const x = rr.getNext(2.0, 3.0);
+    assert(x >= 2.0 && x <= 3.0);
+  }
+
+  var ru = new owned PhiloxRandomStream(uint(8), seed=7);
+  for 1..n do
+    assert(ru.getNext(min(uint(8)), max(uint(8))) <= max(uint(8)));
+  writeln("bounded: OK");
+}
+
+// permutation and shuffle
+{
+  var rs = new owned PhiloxRandomStream(int, seed=11);
+  var P: [0..99] int;
+  rs.permutation(P);
+  var counts: [0..99] int;
+  for p in P do counts[p] += 1;
+  assert(&& reduce (counts == 1));
+
+  var A: [1..50 by 3] int = 1..50 by 3;
+  rs.shuffle(A);
+  var sorted = true;
+  for i in A.domain do
+    if i > 1 && A[i] < A[i-3] then sorted = false;
+  assert(!sorted);
+  assert(+ reduce A == + reduce (1..50 by 3));
+  writeln("permutation/shuffle: OK");
+}
@@ -0,0 +1,46 @@
+config const n = 3;
+
+class Shape {
+  proc area(): real { return 0.0; }
+  proc name(): string { return "shape"; }
+}
+
+class Square: Shape {
+  var s: real;
+  override proc area(): real { return s*s; }
+  override proc name(): string { return "square"; }
+}
+
+class Circle: Shape {
+  var r: real;
+  override proc area(): real { return 3.0*r*r; }
+}
+
+proc report(sh: borrowed Shape) {
+  // Shape.area, Square.area or Circle.area: stays virtual
+  const a = sh.area();
+
+  // Square.name or Shape.name: guarded direct calls
+  writeln(sh.name(), " ", a);
+}
+
+proc main() {
+  var total = 0.0;
+
+  for i in 1..n {
+    var sq = new owned Square(i);
+    var c  = new owned Circle(i);
+
+    total += sq.area() + c.area();
+
+    // No subclass of Circle is created: a direct call to Shape.name
+    writeln(c.name());
+
+    report(sq.borrow());
+    report(c.borrow());
+  }
+
+  report(new owned Shape());
+
+  writeln(total);
+}
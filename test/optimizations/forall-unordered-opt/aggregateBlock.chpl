@@ -0,0 +1,31 @@
+use BlockDist;
+
+config const n = 10000;
+
+// Every task writes to indices spread over all the locales, so most
+// of the aggregated operations are applied remotely.
+proc target(i: int) {
+  return (i * 7919) % n;
+}
+
+const D = {0..#n} dmapped Block({0..#n});
+var A: [D] int;
+var H: [D] int;
+var R: [D] real;
+
+forall i in D {
+  A[target(i)] = i;
+}
+
+forall i in D {
+  H[i % 100] += 1;
+}
+
+forall i in D {
+  R[target(i)] += 0.5;
+}
+
+writeln(&& reduce [i in D] A[target(i)] == i);
+writeln(+ reduce H[0..#100], " ", min reduce H[0..#100], " ",
+        max reduce H[0..#100]);
+writeln(+ reduce H[100..], " ", + reduce R);
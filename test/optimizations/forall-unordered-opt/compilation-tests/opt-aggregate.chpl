@@ -0,0 +1,81 @@
+config const N=1000;
+config const M=10000;
+config const choice=true;
+
+// Explicit main included to reduce test maintenance
+proc main() { }
+
+proc mini_scatter() {
+  var A: [0..#M] int;
+  var rindex: [0..#N] int;
+
+  forall i in 0..#N {
+    A[rindex[i]] = i;
+  }
+}
+mini_scatter();
+
+proc mini_histo() {
+  var A: [0..#M] int;
+  var rindex: [0..#N] int;
+
+  forall r in rindex {
+    A[r] += 1;
+  }
+}
+mini_histo();
+
+proc mini_histo_real() {
+  var A: [0..#M] real;
+  var rindex: [0..#N] int;
+
+  forall r in rindex {
+    A[r] += 0.5;
+  }
+}
+mini_histo_real();
+
+proc mini_histo_cond() {
+  var A: [0..#M] int(32);
+  var rindex: [0..#N] int;
+
+  forall r in rindex {
+    if choice then
+      A[r] += 1:int(32);
+    else
+      A[r] = 0:int(32);
+  }
+}
+mini_histo_cond();
+
+proc histo_not_last() {
+  var A: [0..#M] int;
+  var B: [0..#M] int;
+  var rindex: [0..#N] int;
+
+  forall r in rindex {
+    A[r] += 1; // don't aggregate this one
+    B[r] += 1; // this one can be aggregated
+  }
+}
+histo_not_last();
+
+proc histo_sub() {
+  var A: [0..#M] int;
+  var rindex: [0..#N] int;
+
+  forall r in rindex {
+    A[r] -= 1; // don't aggregate: only = and += are
+  }
+}
+histo_sub();
+
+proc histo_task_private() {
+  var A: [0..#M] int;
+  var rindex: [0..#N] int;
+
+  forall r in rindex with (var x = 1) {
+    A[r] += x; // don't aggregate: task private variable
+  }
+}
+histo_task_private();
@@ -0,0 +1,66 @@
+config const n = 4;
+
+class Point {
+  var x, y: real;
+  proc norm2() { return x*x + y*y; }
+}
+
+class Counted: Point {
+  var id: int;
+  override proc norm2() { return super.norm2() + id; }
+  proc deinit() { writeln("deinit ", id); }
+}
+
+class Holder {
+  var p: unmanaged Point;
+}
+
+var saved: unmanaged Point;
+
+proc keep(p: unmanaged Point) { saved = p; }
+
+proc same(p: unmanaged Point) { return p; }
+
+proc main() {
+  var s = 0.0;
+
+  // Deleted in the same block and only read: stack allocated
+  for i in 1..n {
+    var p = new unmanaged Point(i, i+1);
+    s += p.norm2();
+    delete p;
+  }
+
+  // Dynamically dispatched calls and a deinit: stack allocated
+  for i in 1..n {
+    var c: unmanaged Point = new unmanaged Counted(i, i, i);
+    s += same(c).norm2();
+    delete c;
+  }
+
+  // Stored in a global: not stack allocated
+  for i in 1..n {
+    var e = new unmanaged Point(i, i);
+    keep(e);
+    s += saved.norm2();
+    delete e;
+  }
+
+  // The Point is stored in the Holder, so only the Holder is stack allocated
+  {
+    var p = new unmanaged Point(1, 2);
+    var h = new unmanaged Holder(p);
+    s += h.p.norm2();
+    delete h;
+    delete p;
+  }
+
+  // Deleted in a nested block: not stack allocated
+  var q = new unmanaged Point(3, 4);
+  if n > 0 {
+    s += q.norm2();
+    delete q;
+  }
+
+  writeln(s);
+}
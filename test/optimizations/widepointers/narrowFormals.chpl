@@ -0,0 +1,31 @@
+//
+// 'applyStencil' is called with a locally allocated 'Weights' in the hot
+// loop, and with one that may be remote inside the on-statement. Only the
+// latter call should need a wide 'w', so the hot loop keeps a narrow one.
+//
+
+class Weights {
+  var center, side: real;
+}
+
+proc applyStencil(w: borrowed Weights, const ref A: [] real, i: int) {
+  return w.center * A[i] + w.side * (A[i-1] + A[i+1]);
+}
+
+config const n = 10;
+
+proc main() {
+  var A, B: [0..n+1] real;
+  for i in 1..n do A[i] = i;
+
+  var w = new borrowed Weights(0.5, 0.25);
+
+  for i in 1..n do B[i] = applyStencil(w, A, i);
+  writeln(B);
+
+  on Locales[numLocales-1] {
+    var total = 0.0;
+    for i in 1..n do total += applyStencil(w, A, i);
+    writeln(total);
+  }
+}
@@ -0,0 +1,63 @@
+//
+// A 2D stencil whose weights are passed to a helper for every point.  Each
+// locale sweeps serially over its own grid with its own weights, so those
+// calls only need narrow formals.  Checking the weights of locale 0 from the
+// last locale is the only call that passes a remote 'w', and must not make
+// the sweeps pay for wide pointers.
+//
+// Run with --printTiming=true to time the sweeps; the .perfcompopts also
+// report the size of the generated code.
+//
+use Time;
+
+config const n = 64;
+config const iters = 10;
+config const printTiming = false;
+
+class Weights {
+  var center, side, corner: real;
+}
+
+proc applyStencil(w: borrowed Weights, const ref A: [] real, i: int, j: int) {
+  return w.center * A[i, j] +
+         w.side * (A[i-1, j] + A[i+1, j] + A[i, j-1] + A[i, j+1]) +
+         w.corner * (A[i-1, j-1] + A[i-1, j+1] + A[i+1, j-1] + A[i+1, j+1]);
+}
+
+proc sweep(w: borrowed Weights) {
+  const Grid = {0..n+1, 0..n+1}, Inner = {1..n, 1..n};
+  var A, B: [Grid] real;
+  A[n/2, n/2] = 1.0;
+
+  for 1..iters {
+    for (i, j) in Inner do
+      B[i, j] = applyStencil(w, A, i, j);
+    A <=> B;
+  }
+  return + reduce A;
+}
+
+proc main() {
+  var w = new borrowed Weights(0.5, 0.1, 0.025);
+  var sums: [LocaleSpace] real;
+  var t: Timer;
+
+  t.start();
+  coforall loc in Locales do on loc {
+    const myW = new borrowed Weights(0.5, 0.1, 0.025);
+    sums[here.id] = sweep(myW);
+  }
+  t.stop();
+
+  var check: real;
+  on Locales[numLocales-1] {
+    var A: [0..2, 0..2] real = 1.0;
+    check = applyStencil(w, A, 1, 1);
+  }
+
+  writeln("same sums: ", && reduce (sums == sums[0]));
+  writeln("sum: ", sums[0]);
+  writeln("check: ", check);
+  if printTiming then
+    writeln("Time: ", t.elapsed());
+}
@@ -0,0 +1,88 @@
+use Regexp;
+use IO;
+use Time;
+use Random;
+
+config const timing = true;
+config const n = 100000;
+config const npatterns = 200;
+config const seed = 31415;
+
+// Log lines to classify, and one pattern per request id, status and path
+const methods = ["GET", "POST", "PUT", "DELETE"];
+const paths = ["/index.html", "/api/v1/users/list", "/static/js/app.min.js",
+               "/api/v1/orders/search", "/favicon.ico"];
+const statuses = ["200", "304", "404", "500"];
+
+var Lines: [1..n] string;
+var rs = new owned RandomStream(int, seed);
+for line in Lines {
+  proc pick(const ref A) {
+    return A[A.domain.low + mod(rs.getNext(), A.size)];
+  }
+  line = "10.0.0." + mod(rs.getNext(), 256):string + " \"" + pick(methods) +
+         " " + pick(paths) + " HTTP/1.1\" " + pick(statuses) +
+         " id=" + mod(rs.getNext(), 2 * npatterns):string + " done";
+}
+
+var Patterns: [1..npatterns] string;
+for (p, i) in zip(Patterns, 1..) {
+  select i % 4 {
+    when 0 do p = "id=" + i:string + " ";
+    when 1 do p = "\" " + statuses[1 + i / 4 % statuses.size] + " id=" + i:string + " ";
+    when 2 do p = "^10\\.0\\.0\\." + (i % 256):string + " ";
+    otherwise p = methods[1 + i / 4 % methods.size] + " " +
+                  paths[1 + i / 16 % paths.size] + " .* id=" + i:string + " ";
+  }
+}
+
+var file = openmem();
+{
+  var w = file.writer();
+  for line in Lines do w.writeln(line);
+  w.close();
+}
+
+// One regexp at a time
+var tEach: Timer;
+var nEach = 0;
+var Each: [1..npatterns] regexp;
+for (re, p) in zip(Each, Patterns) do re = compile(p);
+if timing then tEach.start();
+for line in Lines do
+  for re in Each do
+    if re.search(line) then nEach += 1;
+if timing then tEach.stop();
+
+// All of the patterns in one pass
+var tSet: Timer;
+var nSet = 0;
+const patternSet = compileSet(Patterns);
+var found: [1..npatterns] int;
+if timing then tSet.start();
+for line in Lines do
+  nSet += patternSet.search(line, found);
+if timing then tSet.stop();
+
+// Streaming over a channel without creating the lines
+var tStream: Timer;
+var nStream = 0;
+if timing then tStream.start();
+{
+  var r = file.reader();
+  var nfound: int;
+  while r.searchLine(patternSet, found, nfound) do
+    nStream += nfound;
+}
+if timing then tStream.stop();
+
+if timing {
+  writeln("each: ", tEach.elapsed());
+  writeln("set: ", tSet.elapsed());
+  writeln("stream: ", tStream.elapsed());
+}
+
+if nEach > 0 && nSet == nEach && nStream == nEach then
+  writeln("SUCCESS");
+else
+  writeln("FAILURE: ", (nEach, nSet, nStream));
@@ -0,0 +1,58 @@
+use Regexp;
+use IO;
+
+const patterns = ["error", "warn(ing)?", "^GET ", "[0-9]{3} [0-9]+$", "timeout"];
+const re = compileSet(patterns);
+writeln(re.size);
+
+var found: [1..patterns.size] int;
+for text in ["GET /index.html 200 512",
+             "warning: disk almost full",
+             "connection timeout after error",
+             "nothing to see here"] {
+  const nfound = re.search(text, found);
+  write(nfound, ":");
+  for i in 1..nfound do write(" ", patterns[found[i]]);
+  writeln(" any=", re.matchesAny(text));
+}
+
+// A buffer smaller than the number of matches keeps the first indices
+var small: [0..0] int;
+writeln(re.search("GET error 404 1", small), " ", small[0]);
+
+// Copies share the compiled set
+var re2: regexpSet;
+re2 = re;
+const re3 = re2;
+writeln(re3.size, " ", re3.matchesAny("warn"));
+
+// Ignoring case applies to every pattern in the set
+const ci = compileSet(["abc", "xyz"], ignorecase=true);
+writeln(ci.search("XYZ and Abc", found), " ", found[1], " ", found[2]);
+
+try {
+  const bad = compileSet(["ok", "(unclosed"]);
+} catch e {
+  writeln(e.message());
+}
+
+// Search every line of a channel. The long line does not fit in the
+// channel buffer and the last one has no trailing newline.
+var f = openmem();
+{
+  var w = f.writer();
+  w.writeln("GET /a 200 10");
+  w.writeln("");
+  w.writeln("x" * 100000 + " timeout");
+  w.write("warn only");
+  w.close();
+}
+var r = f.reader();
+var nfound: int;
+var offset = r.offset();
+while r.searchLine(re, found, nfound) {
+  write(offset, " ", nfound, ":");
+  for i in 1..nfound do write(" ", found[i]);
+  writeln();
+  offset = r.offset();
+}
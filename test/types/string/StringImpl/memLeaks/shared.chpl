@@ -0,0 +1,63 @@
+module unitTest {
+  use main;
+
+  // Strings at least chpl_stringShareMinLen bytes long share their buffer
+  // between copies; make sure writes detach and nothing leaks.
+
+  proc sharedCopy(type t) {
+    writeln("=== shared copy");
+    const m0 = allMemoryUsed();
+    {
+      const s0: t = "0123456789" * 7;
+      var s1 = s0;
+      var s2: t;
+      s2 = s1;
+      s1 += "!";
+      writeMe(s0);
+      writeMe(s1);
+      writeMe(s2);
+    }
+    checkMemLeaks(m0);
+  }
+
+  proc sharedAssign(type t) {
+    writeln("=== shared assignment");
+    const m0 = allMemoryUsed();
+    {
+      var s0: t = "abcdefghij" * 7;
+      var s1 = s0;
+      s0 = "short";
+      writeMe(s0);
+      writeMe(s1);
+      s1 = s1;
+      s0 = s1;
+      s1 = "0123456789" * 7;
+      writeMe(s0);
+      writeMe(s1);
+    }
+    checkMemLeaks(m0);
+  }
+
+  proc sharedRemote(type t) {
+    writeln("=== shared remote");
+    const m0 = allMemoryUsed();
+    {
+      const s0: t = "0123456789" * 7;
+      on Locales[numLocales-1] {
+        var s1 = s0;
+        var s2 = s1;
+        s2 += "?";
+        writeMe(s1);
+        writeMe(s2);
+      }
+    }
+    checkMemLeaks(m0);
+  }
+
+  proc doIt(type t) {
+    sharedCopy(t);
+    sharedAssign(t);
+    sharedRemote(t);
+  }
+
+}
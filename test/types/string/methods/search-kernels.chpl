@@ -0,0 +1,86 @@
+// Compare the string search methods against a brute-force search over
+// strings long enough to use the vectorized paths in the runtime.
+use Random;
+
+config const seed = 271828;
+config const trials = 2000;
+
+var rs = new owned RandomStream(int, seed);
+
+proc randomString(len: int, nLetters: int) {
+  var s: string;
+  for 1..len do
+    s += ascii("a") + mod(rs.getNext(), nLetters): uint(8);
+  return s;
+}
+
+proc matchesAt(s: string, i: int, needle: string) {
+  for j in 1..needle.length do
+    if s.byte(i+j-1) != needle.byte(j) then return false;
+  return true;
+}
+
+proc refFind(s: string, needle: string, r: range) {
+  for i in r.low..r.high-needle.length+1 do
+    if matchesAt(s, i, needle) then return i;
+  return 0;
+}
+
+proc refRFind(s: string, needle: string, r: range) {
+  for i in r.low..r.high-needle.length+1 by -1 do
+    if matchesAt(s, i, needle) then return i;
+  return 0;
+}
+
+proc refCount(s: string, needle: string, r: range) {
+  var c = 0;
+  for i in r.low..r.high-needle.length+1 do
+    if matchesAt(s, i, needle) then c += 1;
+  return c;
+}
+
+var errors = 0;
+for t in 1..trials {
+  const len = mod(rs.getNext(), 150);
+  const nLetters = 2 + mod(rs.getNext(), 3);
+  const s = randomString(len, nLetters);
+  const needle = randomString(1 + mod(rs.getNext(), 5), nLetters);
+  const lo = 1 + mod(rs.getNext(), 10);
+  const r = if lo <= len then lo..len else 1..len;
+
+  if s.find(needle, r) != refFind(s, needle, r) ||
+     s.rfind(needle, r) != refRFind(s, needle, r) ||
+     s.count(needle, r) != refCount(s, needle, r) {
+    writeln("mismatch searching '", s, "'[", r, "] for '", needle, "'");
+    errors += 1;
+  }
+}
+
+// Overlapping matches are counted
+writeln("aaaa".count("aa"));
+writeln(("ab" * 40).count("bab"));
+writeln(("ab" * 40).rfind("ba"));
+writeln(("x" * 70 + "needle").find("needle"));
+
+// replace does not rescan replaced text and honors count
+writeln("aaaa".replace("aa", "a"));
+writeln(("ab" * 20).replace("ab", "xyz", count=3));
+writeln("abc".replace("", "x"));
+writeln("a.b.c".replace(".", ""));
+
+// replace with nothing to replace still returns a string that owns its
+// buffer, even when called on a temporary
+proc makeLine(i: int) return "GET /index.html " + i:string;
+const unchanged = makeLine(1).replace("zzz", "y");
+writeln(unchanged, " ", unchanged.isowned);
+
+for field in "GET /api/v1/users HTTP/1.1".split(" ") do
+  writeln(field);
+
+// ASCII fast paths and non-ASCII strings agree
+writeln(("0123456789" * 5).isDigit(), " ", ("0123456789" * 5 + "x").isDigit());
+writeln(" \t\n\r\x0b\x0c".isSpace(), " ", ("  " * 20 + "x").isSpace());
+writeln("１２３".isDigit(), " ", "12ä".isDigit(), " ", " 　 ".isSpace());
+
+if errors == 0 then
+  writeln("SUCCESS");
@@ -0,0 +1,16 @@
+// Count the string buffer allocations made by common parsing kernels.
+// Each field yielded by split() should cost exactly one allocation, and
+// copies of long strings should share their buffer instead of allocating.
+use Memory;
+
+const line = "alpha beta gamma,delta epsilon,zeta eta theta";
+const longLine = line * 4;
+var n = 0;
+
+startVerboseMemHere();
+for w in line.split() do n += w.length;
+for f in line.split(",") do n += f.length;
+{ const a = longLine; var b = a; n += b.length; }
+stopVerboseMemHere();
+
+writeln(n);
@@ -0,0 +1,91 @@
+use Time;
+use Random;
+
+config const timing = true;
+config const n = 1000000;
+config const seed = 31415;
+
+// Build log lines that look like those of a web server
+const hosts = ["10.0.0.17", "192.168.4.201", "172.16.30.5", "10.2.99.240"];
+const methods = ["GET", "POST", "PUT", "DELETE"];
+const paths = ["/index.html", "/api/v1/users/list", "/static/js/app.min.js",
+               "/api/v1/orders/search?q=widgets&page=3", "/favicon.ico"];
+const statuses = ["200", "200", "200", "304", "404", "500"];
+const agents = ["Mozilla/5.0 (X11; Linux x86_64) Gecko/20100101 Firefox/66.0",
+                "curl/7.58.0",
+                "Mozilla/5.0 (Windows NT 10.0; Win64; x64) Chrome/73.0"];
+
+var Lines: [1..n] string;
+var rs = new owned RandomStream(int, seed);
+for (line, i) in zip(Lines, 1..) {
+  proc pick(const ref A) {
+    return A[A.domain.low + mod(rs.getNext(), A.size)];
+  }
+  line = pick(hosts) + " - - [18/Mar/2019:10:" + (i % 60):string +
+         ":07 -0700] \"" + pick(methods) + " " + pick(paths) +
+         " HTTP/1.1\" " + pick(statuses) + " " + (i % 5000):string +
+         " \"-\" \"" + pick(agents) + "\"";
+}
+
+// find
+var tFind: Timer;
+var nFound = 0;
+if timing then tFind.start();
+for line in Lines do
+  if line.find("\" 500 ") then nFound += 1;
+if timing then tFind.stop();
+
+// rfind
+var tRFind: Timer;
+var lastQuote = 0;
+if timing then tRFind.start();
+for line in Lines do
+  lastQuote += line.rfind("\"");
+if timing then tRFind.stop();
+
+// count
+var tCount: Timer;
+var nSlashes = 0;
+if timing then tCount.start();
+for line in Lines do
+  nSlashes += line.count("/");
+if timing then tCount.stop();
+
+// split
+var tSplit: Timer;
+var nFields = 0;
+if timing then tSplit.start();
+for line in Lines do
+  for field in line.split(" ") do
+    nFields += 1;
+if timing then tSplit.stop();
+
+// replace
+var tReplace: Timer;
+var replacedLen = 0;
+if timing then tReplace.start();
+for line in Lines do
+  replacedLen += line.replace("HTTP/1.1", "HTTP/2").length;
+if timing then tReplace.stop();
+
+// isDigit
+var tIsDigit: Timer;
+var nDigits = 0;
+if timing then tIsDigit.start();
+for line in Lines do
+  for field in line.split(" ", maxsplit=9) do
+    if field.isDigit() then nDigits += 1;
+if timing then tIsDigit.stop();
+
+if timing {
+  writeln("find: ", tFind.elapsed());
+  writeln("rfind: ", tRFind.elapsed());
+  writeln("count: ", tCount.elapsed());
+  writeln("split: ", tSplit.elapsed());
+  writeln("replace: ", tReplace.elapsed());
+  writeln("isDigit: ", tIsDigit.elapsed());
+}
+
+if nFound > 0 && lastQuote > 0 && nSlashes > 0 && nFields > 0 &&
+   replacedLen > 0 && nDigits > 0 then
+  writeln("SUCCESS");
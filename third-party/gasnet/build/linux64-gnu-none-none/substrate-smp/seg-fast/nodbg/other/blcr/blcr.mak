@@ -0,0 +1,34 @@
+# BLCR Makefile fragment
+# This Makefile fragment is used to build GASNet conduits 
+# it is not meant to be used directly 
+#
+# To use in a conduit Makefile.am just include this fragment.
+# Example:
+#    include $(top_builddir)/other/blcr/blcr.mak
+#
+# This fragment defines the following variables for use
+# in the corresponding CONDUIT_* variables.  For instance,
+# one should include $(blcr_sourcelist) in CONDUIT_SOURCELIST
+#
+# blcr_sourcelist     - C files to build normally
+# blcr_extralibcflags - CFLAGS needed for BLCR headers
+# blcr_extraheaders   - header(s) to install from blcr directory
+# blcr_privheaders    - header(s) to not install (but would be by default rules)
+# blcr_extradeps      - libgasnet dependencies on BLCR .c and .h files
+# blcr_special_objs   - BLCR .o files with "abonormal" build requirements
+#
+# blcr_{src,bld}dir are also set, but probably aren't needed outside this fragment
+
+blcr_srcdir         = $(top_srcdir)/other/blcr
+blcr_blddir         = $(top_builddir)/other/blcr
+
+blcr_sourcelist     = $(blcr_srcdir)/gasnet_blcr.c
+blcr_extraheaders   = # None currently
+blcr_privheaders    = # None currently
+blcr_extralibcflags = -I$(blcr_srcdir) 
+blcr_extradeps      = $(blcr_srcdir)/gasnet_blcr.h $(blcr_blddir)/blcr.mak
+blcr_special_objs   = # None currently
+
+# How to rebuild this file
+$(blcr_blddir)/blcr.mak: $(blcr_srcdir)/blcr.mak.in
+	cd $(@D) && $(MAKE) $(@F)